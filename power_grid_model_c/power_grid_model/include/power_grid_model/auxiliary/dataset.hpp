@@ -164,6 +164,27 @@ template <typename T, dataset_type_tag dataset_type> class ColumnarAttributeRang
     auto iter() const { return std::ranges::subrange{begin(), end()}; }
     auto operator[](Idx idx) const { return *get(idx); }
 
+    // copy all elements into row based structs, one attribute column at a time
+    // the ctype is resolved once per attribute instead of once per element and attribute,
+    // so the inner loop is a plain strided copy
+    // the attributes which are not in the columnar buffers keep their value in the destination
+    void copy_to(std::span<typename Proxy::value_type> destination) const {
+        assert(static_cast<Idx>(destination.size()) == size_);
+        for (auto const& attribute_buffer : attribute_buffers_) {
+            assert(attribute_buffer.meta_attribute != nullptr);
+            auto const& meta_attribute = *attribute_buffer.meta_attribute;
+            ctype_func_selector(meta_attribute.ctype, [&destination, &attribute_buffer, &meta_attribute,
+                                                       this]<typename AttributeType> {
+                AttributeType const* const column =
+                    reinterpret_cast<AttributeType const*>(attribute_buffer.data) + start_;
+                for (Idx idx = 0; idx != size_; ++idx) {
+                    meta_attribute.template get_attribute<AttributeType>(
+                        reinterpret_cast<RawDataPtr>(&destination[idx])) = column[idx];
+                }
+            });
+        }
+    }
+
   private:
     iterator get(Idx idx) const { return iterator{start_ + idx, attribute_buffers_}; }
 
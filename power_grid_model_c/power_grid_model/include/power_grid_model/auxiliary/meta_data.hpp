@@ -19,28 +19,35 @@ namespace power_grid_model::meta_data {
 // primary template to get the attribute list of a component
 // the specializations will contain static constexpr "value" field
 //    which is a std::array
+//    and a static "visit_values" function to visit the values of all attributes in the same order
 // the specializations are automatically generated
 template <class T> struct get_attributes_list;
 
 // ctype string
 template <class T> struct ctype_t;
 template <> struct ctype_t<double> {
+    using type = double;
     static constexpr CType value = CType::c_double;
 };
 template <> struct ctype_t<int32_t> {
+    using type = int32_t;
     static constexpr CType value = CType::c_int32;
 };
 template <> struct ctype_t<int8_t> {
+    using type = int8_t;
     static constexpr CType value = CType::c_int8;
 };
 
 template <> struct ctype_t<RealValue<asymmetric_t>> {
+    using type = RealValue<asymmetric_t>;
     static constexpr CType value = CType::c_double3;
 };
 template <class T>
     requires std::is_enum_v<T>
 struct ctype_t<T> : ctype_t<std::underlying_type_t<T>> {};
 template <class T> constexpr CType ctype_v = ctype_t<T>::value;
+// the type of the value as used for the ctype, e.g. the underlying type of an enum
+template <class T> using ctype_type_t = typename ctype_t<T>::type;
 
 // function selector based on ctype
 // the operator() of the functor should have a single template parameter
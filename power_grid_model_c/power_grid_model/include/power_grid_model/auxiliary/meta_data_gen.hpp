@@ -23,10 +23,18 @@
 namespace power_grid_model::meta_data::meta_data_gen {
 
 // generate meta data
-constexpr MetaData meta_data =
+using meta_data_getter =
     get_meta_data<AllComponents, // all components list
                   input_getter_s, update_getter_s, sym_output_getter_s, asym_output_getter_s, sc_output_getter_s
                   // end list of all marks
-                  >::value;
+                  >;
+constexpr MetaData meta_data = meta_data_getter::value;
+
+// call the functor templated on the struct type of a component of the generated meta data,
+//     e.g. to use the generated attribute visitor of the component
+// returns false without calling the functor if the component is not part of the generated meta data
+template <class Functor> bool visit_component_struct(MetaComponent const& component, Functor&& functor) {
+    return meta_data_getter::visit_struct(component, functor);
+}
 
 } // namespace power_grid_model::meta_data::meta_data_gen
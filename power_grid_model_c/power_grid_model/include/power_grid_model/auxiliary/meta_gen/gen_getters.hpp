@@ -8,6 +8,9 @@
 #include "../../common/counting_iterator.hpp"
 #include "../meta_data.hpp"
 
+#include <array>
+#include <functional>
+
 namespace power_grid_model::meta_data::meta_data_gen {
 
 // pointer to member
@@ -89,6 +92,22 @@ struct get_meta_dataset<struct_getter, ComponentList<ComponentType...>> {
         .name = struct_getter::name,
         .components = components,
     };
+
+    // table to call a functor templated on the struct type of each component
+    template <class Functor>
+    static constexpr std::array<void (*)(Functor&), n_components> struct_visitors{
+        [](Functor& functor) {
+            functor.template operator()<typename struct_getter::template type<ComponentType>>();
+        }...};
+
+    template <class Functor> static bool visit_struct(MetaComponent const& component, Functor& functor) {
+        auto const* const begin = components.data();
+        if (std::less<>{}(&component, begin) || !std::less<>{}(&component, begin + n_components)) {
+            return false;
+        }
+        struct_visitors<Functor>[&component - begin](functor);
+        return true;
+    }
 };
 
 // get meta data
@@ -98,6 +117,12 @@ template <class comp_list, class... struct_getter> struct get_meta_data {
     static constexpr MetaData value{
         .datasets = datasets,
     };
+
+    // call the functor templated on the struct type of the component
+    // returns false if the component is not part of this meta data
+    template <class Functor> static bool visit_struct(MetaComponent const& component, Functor& functor) {
+        return (get_meta_dataset<struct_getter, comp_list>::visit_struct(component, functor) || ...);
+    }
 };
 
 } // namespace power_grid_model::meta_data::meta_data_gen
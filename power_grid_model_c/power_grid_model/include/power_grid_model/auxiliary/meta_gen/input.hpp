@@ -28,6 +28,13 @@ struct get_attributes_list<BaseInput> {
             
             meta_data_gen::get_meta_attribute<&BaseInput::id>(offsetof(BaseInput, id), "id"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+    }
 };
 
 template<>
@@ -38,6 +45,14 @@ struct get_attributes_list<NodeInput> {
             meta_data_gen::get_meta_attribute<&NodeInput::id>(offsetof(NodeInput, id), "id"),
             meta_data_gen::get_meta_attribute<&NodeInput::u_rated>(offsetof(NodeInput, u_rated), "u_rated"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.u_rated);
+    }
 };
 
 template<>
@@ -51,6 +66,17 @@ struct get_attributes_list<BranchInput> {
             meta_data_gen::get_meta_attribute<&BranchInput::from_status>(offsetof(BranchInput, from_status), "from_status"),
             meta_data_gen::get_meta_attribute<&BranchInput::to_status>(offsetof(BranchInput, to_status), "to_status"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.from_node);
+            functor(value.to_node);
+            functor(value.from_status);
+            functor(value.to_status);
+    }
 };
 
 template<>
@@ -66,6 +92,19 @@ struct get_attributes_list<Branch3Input> {
             meta_data_gen::get_meta_attribute<&Branch3Input::status_2>(offsetof(Branch3Input, status_2), "status_2"),
             meta_data_gen::get_meta_attribute<&Branch3Input::status_3>(offsetof(Branch3Input, status_3), "status_3"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.node_1);
+            functor(value.node_2);
+            functor(value.node_3);
+            functor(value.status_1);
+            functor(value.status_2);
+            functor(value.status_3);
+    }
 };
 
 template<>
@@ -76,6 +115,14 @@ struct get_attributes_list<SensorInput> {
             meta_data_gen::get_meta_attribute<&SensorInput::id>(offsetof(SensorInput, id), "id"),
             meta_data_gen::get_meta_attribute<&SensorInput::measured_object>(offsetof(SensorInput, measured_object), "measured_object"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.measured_object);
+    }
 };
 
 template<>
@@ -87,6 +134,15 @@ struct get_attributes_list<ApplianceInput> {
             meta_data_gen::get_meta_attribute<&ApplianceInput::node>(offsetof(ApplianceInput, node), "node"),
             meta_data_gen::get_meta_attribute<&ApplianceInput::status>(offsetof(ApplianceInput, status), "status"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.node);
+            functor(value.status);
+    }
 };
 
 template<>
@@ -109,6 +165,26 @@ struct get_attributes_list<LineInput> {
             meta_data_gen::get_meta_attribute<&LineInput::tan0>(offsetof(LineInput, tan0), "tan0"),
             meta_data_gen::get_meta_attribute<&LineInput::i_n>(offsetof(LineInput, i_n), "i_n"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.from_node);
+            functor(value.to_node);
+            functor(value.from_status);
+            functor(value.to_status);
+            functor(value.r1);
+            functor(value.x1);
+            functor(value.c1);
+            functor(value.tan1);
+            functor(value.r0);
+            functor(value.x0);
+            functor(value.c0);
+            functor(value.tan0);
+            functor(value.i_n);
+    }
 };
 
 template<>
@@ -129,6 +205,24 @@ struct get_attributes_list<GenericBranchInput> {
             meta_data_gen::get_meta_attribute<&GenericBranchInput::theta>(offsetof(GenericBranchInput, theta), "theta"),
             meta_data_gen::get_meta_attribute<&GenericBranchInput::sn>(offsetof(GenericBranchInput, sn), "sn"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.from_node);
+            functor(value.to_node);
+            functor(value.from_status);
+            functor(value.to_status);
+            functor(value.r1);
+            functor(value.x1);
+            functor(value.g1);
+            functor(value.b1);
+            functor(value.k);
+            functor(value.theta);
+            functor(value.sn);
+    }
 };
 
 template<>
@@ -142,6 +236,17 @@ struct get_attributes_list<LinkInput> {
             meta_data_gen::get_meta_attribute<&LinkInput::from_status>(offsetof(LinkInput, from_status), "from_status"),
             meta_data_gen::get_meta_attribute<&LinkInput::to_status>(offsetof(LinkInput, to_status), "to_status"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.from_node);
+            functor(value.to_node);
+            functor(value.from_status);
+            functor(value.to_status);
+    }
 };
 
 template<>
@@ -179,6 +284,41 @@ struct get_attributes_list<TransformerInput> {
             meta_data_gen::get_meta_attribute<&TransformerInput::r_grounding_to>(offsetof(TransformerInput, r_grounding_to), "r_grounding_to"),
             meta_data_gen::get_meta_attribute<&TransformerInput::x_grounding_to>(offsetof(TransformerInput, x_grounding_to), "x_grounding_to"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.from_node);
+            functor(value.to_node);
+            functor(value.from_status);
+            functor(value.to_status);
+            functor(value.u1);
+            functor(value.u2);
+            functor(value.sn);
+            functor(value.uk);
+            functor(value.pk);
+            functor(value.i0);
+            functor(value.p0);
+            functor(value.winding_from);
+            functor(value.winding_to);
+            functor(value.clock);
+            functor(value.tap_side);
+            functor(value.tap_pos);
+            functor(value.tap_min);
+            functor(value.tap_max);
+            functor(value.tap_nom);
+            functor(value.tap_size);
+            functor(value.uk_min);
+            functor(value.uk_max);
+            functor(value.pk_min);
+            functor(value.pk_max);
+            functor(value.r_grounding_from);
+            functor(value.x_grounding_from);
+            functor(value.r_grounding_to);
+            functor(value.x_grounding_to);
+    }
 };
 
 template<>
@@ -237,6 +377,62 @@ struct get_attributes_list<ThreeWindingTransformerInput> {
             meta_data_gen::get_meta_attribute<&ThreeWindingTransformerInput::r_grounding_3>(offsetof(ThreeWindingTransformerInput, r_grounding_3), "r_grounding_3"),
             meta_data_gen::get_meta_attribute<&ThreeWindingTransformerInput::x_grounding_3>(offsetof(ThreeWindingTransformerInput, x_grounding_3), "x_grounding_3"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.node_1);
+            functor(value.node_2);
+            functor(value.node_3);
+            functor(value.status_1);
+            functor(value.status_2);
+            functor(value.status_3);
+            functor(value.u1);
+            functor(value.u2);
+            functor(value.u3);
+            functor(value.sn_1);
+            functor(value.sn_2);
+            functor(value.sn_3);
+            functor(value.uk_12);
+            functor(value.uk_13);
+            functor(value.uk_23);
+            functor(value.pk_12);
+            functor(value.pk_13);
+            functor(value.pk_23);
+            functor(value.i0);
+            functor(value.p0);
+            functor(value.winding_1);
+            functor(value.winding_2);
+            functor(value.winding_3);
+            functor(value.clock_12);
+            functor(value.clock_13);
+            functor(value.tap_side);
+            functor(value.tap_pos);
+            functor(value.tap_min);
+            functor(value.tap_max);
+            functor(value.tap_nom);
+            functor(value.tap_size);
+            functor(value.uk_12_min);
+            functor(value.uk_12_max);
+            functor(value.uk_13_min);
+            functor(value.uk_13_max);
+            functor(value.uk_23_min);
+            functor(value.uk_23_max);
+            functor(value.pk_12_min);
+            functor(value.pk_12_max);
+            functor(value.pk_13_min);
+            functor(value.pk_13_max);
+            functor(value.pk_23_min);
+            functor(value.pk_23_max);
+            functor(value.r_grounding_1);
+            functor(value.x_grounding_1);
+            functor(value.r_grounding_2);
+            functor(value.x_grounding_2);
+            functor(value.r_grounding_3);
+            functor(value.x_grounding_3);
+    }
 };
 
 template<>
@@ -249,6 +445,16 @@ struct get_attributes_list<GenericLoadGenInput> {
             meta_data_gen::get_meta_attribute<&GenericLoadGenInput::status>(offsetof(GenericLoadGenInput, status), "status"),
             meta_data_gen::get_meta_attribute<&GenericLoadGenInput::type>(offsetof(GenericLoadGenInput, type), "type"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.node);
+            functor(value.status);
+            functor(value.type);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -265,6 +471,18 @@ struct get_attributes_list<LoadGenInput<sym_type>> {
             meta_data_gen::get_meta_attribute<&LoadGenInput<sym>::p_specified>(offsetof(LoadGenInput<sym>, p_specified), "p_specified"),
             meta_data_gen::get_meta_attribute<&LoadGenInput<sym>::q_specified>(offsetof(LoadGenInput<sym>, q_specified), "q_specified"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.node);
+            functor(value.status);
+            functor(value.type);
+            functor(value.p_specified);
+            functor(value.q_specified);
+    }
 };
 
 template<>
@@ -280,6 +498,19 @@ struct get_attributes_list<ShuntInput> {
             meta_data_gen::get_meta_attribute<&ShuntInput::g0>(offsetof(ShuntInput, g0), "g0"),
             meta_data_gen::get_meta_attribute<&ShuntInput::b0>(offsetof(ShuntInput, b0), "b0"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.node);
+            functor(value.status);
+            functor(value.g1);
+            functor(value.b1);
+            functor(value.g0);
+            functor(value.b0);
+    }
 };
 
 template<>
@@ -296,6 +527,20 @@ struct get_attributes_list<SourceInput> {
             meta_data_gen::get_meta_attribute<&SourceInput::rx_ratio>(offsetof(SourceInput, rx_ratio), "rx_ratio"),
             meta_data_gen::get_meta_attribute<&SourceInput::z01_ratio>(offsetof(SourceInput, z01_ratio), "z01_ratio"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.node);
+            functor(value.status);
+            functor(value.u_ref);
+            functor(value.u_ref_angle);
+            functor(value.sk);
+            functor(value.rx_ratio);
+            functor(value.z01_ratio);
+    }
 };
 
 template<>
@@ -307,6 +552,15 @@ struct get_attributes_list<GenericVoltageSensorInput> {
             meta_data_gen::get_meta_attribute<&GenericVoltageSensorInput::measured_object>(offsetof(GenericVoltageSensorInput, measured_object), "measured_object"),
             meta_data_gen::get_meta_attribute<&GenericVoltageSensorInput::u_sigma>(offsetof(GenericVoltageSensorInput, u_sigma), "u_sigma"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.measured_object);
+            functor(value.u_sigma);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -322,6 +576,17 @@ struct get_attributes_list<VoltageSensorInput<sym_type>> {
             meta_data_gen::get_meta_attribute<&VoltageSensorInput<sym>::u_measured>(offsetof(VoltageSensorInput<sym>, u_measured), "u_measured"),
             meta_data_gen::get_meta_attribute<&VoltageSensorInput<sym>::u_angle_measured>(offsetof(VoltageSensorInput<sym>, u_angle_measured), "u_angle_measured"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.measured_object);
+            functor(value.u_sigma);
+            functor(value.u_measured);
+            functor(value.u_angle_measured);
+    }
 };
 
 template<>
@@ -334,6 +599,16 @@ struct get_attributes_list<GenericPowerSensorInput> {
             meta_data_gen::get_meta_attribute<&GenericPowerSensorInput::measured_terminal_type>(offsetof(GenericPowerSensorInput, measured_terminal_type), "measured_terminal_type"),
             meta_data_gen::get_meta_attribute<&GenericPowerSensorInput::power_sigma>(offsetof(GenericPowerSensorInput, power_sigma), "power_sigma"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.measured_object);
+            functor(value.measured_terminal_type);
+            functor(value.power_sigma);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -352,6 +627,20 @@ struct get_attributes_list<PowerSensorInput<sym_type>> {
             meta_data_gen::get_meta_attribute<&PowerSensorInput<sym>::p_sigma>(offsetof(PowerSensorInput<sym>, p_sigma), "p_sigma"),
             meta_data_gen::get_meta_attribute<&PowerSensorInput<sym>::q_sigma>(offsetof(PowerSensorInput<sym>, q_sigma), "q_sigma"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.measured_object);
+            functor(value.measured_terminal_type);
+            functor(value.power_sigma);
+            functor(value.p_measured);
+            functor(value.q_measured);
+            functor(value.p_sigma);
+            functor(value.q_sigma);
+    }
 };
 
 template<>
@@ -367,6 +656,19 @@ struct get_attributes_list<FaultInput> {
             meta_data_gen::get_meta_attribute<&FaultInput::r_f>(offsetof(FaultInput, r_f), "r_f"),
             meta_data_gen::get_meta_attribute<&FaultInput::x_f>(offsetof(FaultInput, x_f), "x_f"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status);
+            functor(value.fault_type);
+            functor(value.fault_phase);
+            functor(value.fault_object);
+            functor(value.r_f);
+            functor(value.x_f);
+    }
 };
 
 template<>
@@ -378,6 +680,15 @@ struct get_attributes_list<RegulatorInput> {
             meta_data_gen::get_meta_attribute<&RegulatorInput::regulated_object>(offsetof(RegulatorInput, regulated_object), "regulated_object"),
             meta_data_gen::get_meta_attribute<&RegulatorInput::status>(offsetof(RegulatorInput, status), "status"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.regulated_object);
+            functor(value.status);
+    }
 };
 
 template<>
@@ -394,6 +705,20 @@ struct get_attributes_list<TransformerTapRegulatorInput> {
             meta_data_gen::get_meta_attribute<&TransformerTapRegulatorInput::line_drop_compensation_r>(offsetof(TransformerTapRegulatorInput, line_drop_compensation_r), "line_drop_compensation_r"),
             meta_data_gen::get_meta_attribute<&TransformerTapRegulatorInput::line_drop_compensation_x>(offsetof(TransformerTapRegulatorInput, line_drop_compensation_x), "line_drop_compensation_x"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.regulated_object);
+            functor(value.status);
+            functor(value.control_side);
+            functor(value.u_set);
+            functor(value.u_band);
+            functor(value.line_drop_compensation_r);
+            functor(value.line_drop_compensation_x);
+    }
 };
 
 template<>
@@ -408,6 +733,18 @@ struct get_attributes_list<GenericCurrentSensorInput> {
             meta_data_gen::get_meta_attribute<&GenericCurrentSensorInput::i_sigma>(offsetof(GenericCurrentSensorInput, i_sigma), "i_sigma"),
             meta_data_gen::get_meta_attribute<&GenericCurrentSensorInput::i_angle_sigma>(offsetof(GenericCurrentSensorInput, i_angle_sigma), "i_angle_sigma"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.measured_object);
+            functor(value.measured_terminal_type);
+            functor(value.angle_measurement_type);
+            functor(value.i_sigma);
+            functor(value.i_angle_sigma);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -426,6 +763,20 @@ struct get_attributes_list<CurrentSensorInput<sym_type>> {
             meta_data_gen::get_meta_attribute<&CurrentSensorInput<sym>::i_measured>(offsetof(CurrentSensorInput<sym>, i_measured), "i_measured"),
             meta_data_gen::get_meta_attribute<&CurrentSensorInput<sym>::i_angle_measured>(offsetof(CurrentSensorInput<sym>, i_angle_measured), "i_angle_measured"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.measured_object);
+            functor(value.measured_terminal_type);
+            functor(value.angle_measurement_type);
+            functor(value.i_sigma);
+            functor(value.i_angle_sigma);
+            functor(value.i_measured);
+            functor(value.i_angle_measured);
+    }
 };
 
 
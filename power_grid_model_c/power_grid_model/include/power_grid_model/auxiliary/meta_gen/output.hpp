@@ -29,6 +29,14 @@ struct get_attributes_list<BaseOutput> {
             meta_data_gen::get_meta_attribute<&BaseOutput::id>(offsetof(BaseOutput, id), "id"),
             meta_data_gen::get_meta_attribute<&BaseOutput::energized>(offsetof(BaseOutput, energized), "energized"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -46,6 +54,19 @@ struct get_attributes_list<NodeOutput<sym_type>> {
             meta_data_gen::get_meta_attribute<&NodeOutput<sym>::p>(offsetof(NodeOutput<sym>, p), "p"),
             meta_data_gen::get_meta_attribute<&NodeOutput<sym>::q>(offsetof(NodeOutput<sym>, q), "q"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.u_pu);
+            functor(value.u);
+            functor(value.u_angle);
+            functor(value.p);
+            functor(value.q);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -67,6 +88,23 @@ struct get_attributes_list<BranchOutput<sym_type>> {
             meta_data_gen::get_meta_attribute<&BranchOutput<sym>::i_to>(offsetof(BranchOutput<sym>, i_to), "i_to"),
             meta_data_gen::get_meta_attribute<&BranchOutput<sym>::s_to>(offsetof(BranchOutput<sym>, s_to), "s_to"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.loading);
+            functor(value.p_from);
+            functor(value.q_from);
+            functor(value.i_from);
+            functor(value.s_from);
+            functor(value.p_to);
+            functor(value.q_to);
+            functor(value.i_to);
+            functor(value.s_to);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -92,6 +130,27 @@ struct get_attributes_list<Branch3Output<sym_type>> {
             meta_data_gen::get_meta_attribute<&Branch3Output<sym>::i_3>(offsetof(Branch3Output<sym>, i_3), "i_3"),
             meta_data_gen::get_meta_attribute<&Branch3Output<sym>::s_3>(offsetof(Branch3Output<sym>, s_3), "s_3"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.loading);
+            functor(value.p_1);
+            functor(value.q_1);
+            functor(value.i_1);
+            functor(value.s_1);
+            functor(value.p_2);
+            functor(value.q_2);
+            functor(value.i_2);
+            functor(value.s_2);
+            functor(value.p_3);
+            functor(value.q_3);
+            functor(value.i_3);
+            functor(value.s_3);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -109,6 +168,19 @@ struct get_attributes_list<ApplianceOutput<sym_type>> {
             meta_data_gen::get_meta_attribute<&ApplianceOutput<sym>::s>(offsetof(ApplianceOutput<sym>, s), "s"),
             meta_data_gen::get_meta_attribute<&ApplianceOutput<sym>::pf>(offsetof(ApplianceOutput<sym>, pf), "pf"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.p);
+            functor(value.q);
+            functor(value.i);
+            functor(value.s);
+            functor(value.pf);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -123,6 +195,16 @@ struct get_attributes_list<VoltageSensorOutput<sym_type>> {
             meta_data_gen::get_meta_attribute<&VoltageSensorOutput<sym>::u_residual>(offsetof(VoltageSensorOutput<sym>, u_residual), "u_residual"),
             meta_data_gen::get_meta_attribute<&VoltageSensorOutput<sym>::u_angle_residual>(offsetof(VoltageSensorOutput<sym>, u_angle_residual), "u_angle_residual"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.u_residual);
+            functor(value.u_angle_residual);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -137,6 +219,16 @@ struct get_attributes_list<PowerSensorOutput<sym_type>> {
             meta_data_gen::get_meta_attribute<&PowerSensorOutput<sym>::p_residual>(offsetof(PowerSensorOutput<sym>, p_residual), "p_residual"),
             meta_data_gen::get_meta_attribute<&PowerSensorOutput<sym>::q_residual>(offsetof(PowerSensorOutput<sym>, q_residual), "q_residual"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.p_residual);
+            functor(value.q_residual);
+    }
 };
 
 template<>
@@ -147,6 +239,14 @@ struct get_attributes_list<FaultOutput> {
             meta_data_gen::get_meta_attribute<&FaultOutput::id>(offsetof(FaultOutput, id), "id"),
             meta_data_gen::get_meta_attribute<&FaultOutput::energized>(offsetof(FaultOutput, energized), "energized"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+    }
 };
 
 template<>
@@ -159,11 +259,21 @@ struct get_attributes_list<FaultShortCircuitOutput> {
             meta_data_gen::get_meta_attribute<&FaultShortCircuitOutput::i_f>(offsetof(FaultShortCircuitOutput, i_f), "i_f"),
             meta_data_gen::get_meta_attribute<&FaultShortCircuitOutput::i_f_angle>(offsetof(FaultShortCircuitOutput, i_f_angle), "i_f_angle"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.i_f);
+            functor(value.i_f_angle);
+    }
 };
 
 template<>
 struct get_attributes_list<NodeShortCircuitOutput> {
-    static constexpr std::array<MetaAttribute, 5> value{
+    static constexpr std::array<MetaAttribute, 9> value{
             // all attributes including base class
             
             meta_data_gen::get_meta_attribute<&NodeShortCircuitOutput::id>(offsetof(NodeShortCircuitOutput, id), "id"),
@@ -171,7 +281,26 @@ struct get_attributes_list<NodeShortCircuitOutput> {
             meta_data_gen::get_meta_attribute<&NodeShortCircuitOutput::u_pu>(offsetof(NodeShortCircuitOutput, u_pu), "u_pu"),
             meta_data_gen::get_meta_attribute<&NodeShortCircuitOutput::u>(offsetof(NodeShortCircuitOutput, u), "u"),
             meta_data_gen::get_meta_attribute<&NodeShortCircuitOutput::u_angle>(offsetof(NodeShortCircuitOutput, u_angle), "u_angle"),
+            meta_data_gen::get_meta_attribute<&NodeShortCircuitOutput::i_f_three_phase>(offsetof(NodeShortCircuitOutput, i_f_three_phase), "i_f_three_phase"),
+            meta_data_gen::get_meta_attribute<&NodeShortCircuitOutput::i_f_three_phase_angle>(offsetof(NodeShortCircuitOutput, i_f_three_phase_angle), "i_f_three_phase_angle"),
+            meta_data_gen::get_meta_attribute<&NodeShortCircuitOutput::i_f_single_phase>(offsetof(NodeShortCircuitOutput, i_f_single_phase), "i_f_single_phase"),
+            meta_data_gen::get_meta_attribute<&NodeShortCircuitOutput::i_f_single_phase_angle>(offsetof(NodeShortCircuitOutput, i_f_single_phase_angle), "i_f_single_phase_angle"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.u_pu);
+            functor(value.u);
+            functor(value.u_angle);
+            functor(value.i_f_three_phase);
+            functor(value.i_f_three_phase_angle);
+            functor(value.i_f_single_phase);
+            functor(value.i_f_single_phase_angle);
+    }
 };
 
 template<>
@@ -186,6 +315,18 @@ struct get_attributes_list<BranchShortCircuitOutput> {
             meta_data_gen::get_meta_attribute<&BranchShortCircuitOutput::i_to>(offsetof(BranchShortCircuitOutput, i_to), "i_to"),
             meta_data_gen::get_meta_attribute<&BranchShortCircuitOutput::i_to_angle>(offsetof(BranchShortCircuitOutput, i_to_angle), "i_to_angle"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.i_from);
+            functor(value.i_from_angle);
+            functor(value.i_to);
+            functor(value.i_to_angle);
+    }
 };
 
 template<>
@@ -202,6 +343,20 @@ struct get_attributes_list<Branch3ShortCircuitOutput> {
             meta_data_gen::get_meta_attribute<&Branch3ShortCircuitOutput::i_3>(offsetof(Branch3ShortCircuitOutput, i_3), "i_3"),
             meta_data_gen::get_meta_attribute<&Branch3ShortCircuitOutput::i_3_angle>(offsetof(Branch3ShortCircuitOutput, i_3_angle), "i_3_angle"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.i_1);
+            functor(value.i_1_angle);
+            functor(value.i_2);
+            functor(value.i_2_angle);
+            functor(value.i_3);
+            functor(value.i_3_angle);
+    }
 };
 
 template<>
@@ -214,6 +369,16 @@ struct get_attributes_list<ApplianceShortCircuitOutput> {
             meta_data_gen::get_meta_attribute<&ApplianceShortCircuitOutput::i>(offsetof(ApplianceShortCircuitOutput, i), "i"),
             meta_data_gen::get_meta_attribute<&ApplianceShortCircuitOutput::i_angle>(offsetof(ApplianceShortCircuitOutput, i_angle), "i_angle"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.i);
+            functor(value.i_angle);
+    }
 };
 
 template<>
@@ -224,6 +389,14 @@ struct get_attributes_list<SensorShortCircuitOutput> {
             meta_data_gen::get_meta_attribute<&SensorShortCircuitOutput::id>(offsetof(SensorShortCircuitOutput, id), "id"),
             meta_data_gen::get_meta_attribute<&SensorShortCircuitOutput::energized>(offsetof(SensorShortCircuitOutput, energized), "energized"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+    }
 };
 
 template<>
@@ -235,6 +408,15 @@ struct get_attributes_list<TransformerTapRegulatorOutput> {
             meta_data_gen::get_meta_attribute<&TransformerTapRegulatorOutput::energized>(offsetof(TransformerTapRegulatorOutput, energized), "energized"),
             meta_data_gen::get_meta_attribute<&TransformerTapRegulatorOutput::tap_pos>(offsetof(TransformerTapRegulatorOutput, tap_pos), "tap_pos"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.tap_pos);
+    }
 };
 
 template<>
@@ -245,6 +427,14 @@ struct get_attributes_list<RegulatorShortCircuitOutput> {
             meta_data_gen::get_meta_attribute<&RegulatorShortCircuitOutput::id>(offsetof(RegulatorShortCircuitOutput, id), "id"),
             meta_data_gen::get_meta_attribute<&RegulatorShortCircuitOutput::energized>(offsetof(RegulatorShortCircuitOutput, energized), "energized"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -259,6 +449,16 @@ struct get_attributes_list<CurrentSensorOutput<sym_type>> {
             meta_data_gen::get_meta_attribute<&CurrentSensorOutput<sym>::i_residual>(offsetof(CurrentSensorOutput<sym>, i_residual), "i_residual"),
             meta_data_gen::get_meta_attribute<&CurrentSensorOutput<sym>::i_angle_residual>(offsetof(CurrentSensorOutput<sym>, i_angle_residual), "i_angle_residual"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.energized);
+            functor(value.i_residual);
+            functor(value.i_angle_residual);
+    }
 };
 
 
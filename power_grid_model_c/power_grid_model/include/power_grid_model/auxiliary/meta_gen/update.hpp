@@ -28,6 +28,13 @@ struct get_attributes_list<BaseUpdate> {
             
             meta_data_gen::get_meta_attribute<&BaseUpdate::id>(offsetof(BaseUpdate, id), "id"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+    }
 };
 
 template<>
@@ -39,6 +46,15 @@ struct get_attributes_list<BranchUpdate> {
             meta_data_gen::get_meta_attribute<&BranchUpdate::from_status>(offsetof(BranchUpdate, from_status), "from_status"),
             meta_data_gen::get_meta_attribute<&BranchUpdate::to_status>(offsetof(BranchUpdate, to_status), "to_status"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.from_status);
+            functor(value.to_status);
+    }
 };
 
 template<>
@@ -51,6 +67,16 @@ struct get_attributes_list<Branch3Update> {
             meta_data_gen::get_meta_attribute<&Branch3Update::status_2>(offsetof(Branch3Update, status_2), "status_2"),
             meta_data_gen::get_meta_attribute<&Branch3Update::status_3>(offsetof(Branch3Update, status_3), "status_3"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status_1);
+            functor(value.status_2);
+            functor(value.status_3);
+    }
 };
 
 template<>
@@ -61,6 +87,14 @@ struct get_attributes_list<ApplianceUpdate> {
             meta_data_gen::get_meta_attribute<&ApplianceUpdate::id>(offsetof(ApplianceUpdate, id), "id"),
             meta_data_gen::get_meta_attribute<&ApplianceUpdate::status>(offsetof(ApplianceUpdate, status), "status"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status);
+    }
 };
 
 template<>
@@ -73,6 +107,16 @@ struct get_attributes_list<TransformerUpdate> {
             meta_data_gen::get_meta_attribute<&TransformerUpdate::to_status>(offsetof(TransformerUpdate, to_status), "to_status"),
             meta_data_gen::get_meta_attribute<&TransformerUpdate::tap_pos>(offsetof(TransformerUpdate, tap_pos), "tap_pos"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.from_status);
+            functor(value.to_status);
+            functor(value.tap_pos);
+    }
 };
 
 template<>
@@ -86,6 +130,17 @@ struct get_attributes_list<ThreeWindingTransformerUpdate> {
             meta_data_gen::get_meta_attribute<&ThreeWindingTransformerUpdate::status_3>(offsetof(ThreeWindingTransformerUpdate, status_3), "status_3"),
             meta_data_gen::get_meta_attribute<&ThreeWindingTransformerUpdate::tap_pos>(offsetof(ThreeWindingTransformerUpdate, tap_pos), "tap_pos"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status_1);
+            functor(value.status_2);
+            functor(value.status_3);
+            functor(value.tap_pos);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -100,6 +155,16 @@ struct get_attributes_list<LoadGenUpdate<sym_type>> {
             meta_data_gen::get_meta_attribute<&LoadGenUpdate<sym>::p_specified>(offsetof(LoadGenUpdate<sym>, p_specified), "p_specified"),
             meta_data_gen::get_meta_attribute<&LoadGenUpdate<sym>::q_specified>(offsetof(LoadGenUpdate<sym>, q_specified), "q_specified"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status);
+            functor(value.p_specified);
+            functor(value.q_specified);
+    }
 };
 
 template<>
@@ -112,6 +177,16 @@ struct get_attributes_list<SourceUpdate> {
             meta_data_gen::get_meta_attribute<&SourceUpdate::u_ref>(offsetof(SourceUpdate, u_ref), "u_ref"),
             meta_data_gen::get_meta_attribute<&SourceUpdate::u_ref_angle>(offsetof(SourceUpdate, u_ref_angle), "u_ref_angle"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status);
+            functor(value.u_ref);
+            functor(value.u_ref_angle);
+    }
 };
 
 template<>
@@ -126,6 +201,18 @@ struct get_attributes_list<ShuntUpdate> {
             meta_data_gen::get_meta_attribute<&ShuntUpdate::g0>(offsetof(ShuntUpdate, g0), "g0"),
             meta_data_gen::get_meta_attribute<&ShuntUpdate::b0>(offsetof(ShuntUpdate, b0), "b0"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status);
+            functor(value.g1);
+            functor(value.b1);
+            functor(value.g0);
+            functor(value.b0);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -140,6 +227,16 @@ struct get_attributes_list<VoltageSensorUpdate<sym_type>> {
             meta_data_gen::get_meta_attribute<&VoltageSensorUpdate<sym>::u_measured>(offsetof(VoltageSensorUpdate<sym>, u_measured), "u_measured"),
             meta_data_gen::get_meta_attribute<&VoltageSensorUpdate<sym>::u_angle_measured>(offsetof(VoltageSensorUpdate<sym>, u_angle_measured), "u_angle_measured"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.u_sigma);
+            functor(value.u_measured);
+            functor(value.u_angle_measured);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -156,6 +253,18 @@ struct get_attributes_list<PowerSensorUpdate<sym_type>> {
             meta_data_gen::get_meta_attribute<&PowerSensorUpdate<sym>::p_sigma>(offsetof(PowerSensorUpdate<sym>, p_sigma), "p_sigma"),
             meta_data_gen::get_meta_attribute<&PowerSensorUpdate<sym>::q_sigma>(offsetof(PowerSensorUpdate<sym>, q_sigma), "q_sigma"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.power_sigma);
+            functor(value.p_measured);
+            functor(value.q_measured);
+            functor(value.p_sigma);
+            functor(value.q_sigma);
+    }
 };
 
 template<>
@@ -171,6 +280,19 @@ struct get_attributes_list<FaultUpdate> {
             meta_data_gen::get_meta_attribute<&FaultUpdate::r_f>(offsetof(FaultUpdate, r_f), "r_f"),
             meta_data_gen::get_meta_attribute<&FaultUpdate::x_f>(offsetof(FaultUpdate, x_f), "x_f"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status);
+            functor(value.fault_type);
+            functor(value.fault_phase);
+            functor(value.fault_object);
+            functor(value.r_f);
+            functor(value.x_f);
+    }
 };
 
 template<>
@@ -181,6 +303,14 @@ struct get_attributes_list<RegulatorUpdate> {
             meta_data_gen::get_meta_attribute<&RegulatorUpdate::id>(offsetof(RegulatorUpdate, id), "id"),
             meta_data_gen::get_meta_attribute<&RegulatorUpdate::status>(offsetof(RegulatorUpdate, status), "status"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status);
+    }
 };
 
 template<>
@@ -195,6 +325,18 @@ struct get_attributes_list<TransformerTapRegulatorUpdate> {
             meta_data_gen::get_meta_attribute<&TransformerTapRegulatorUpdate::line_drop_compensation_r>(offsetof(TransformerTapRegulatorUpdate, line_drop_compensation_r), "line_drop_compensation_r"),
             meta_data_gen::get_meta_attribute<&TransformerTapRegulatorUpdate::line_drop_compensation_x>(offsetof(TransformerTapRegulatorUpdate, line_drop_compensation_x), "line_drop_compensation_x"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.status);
+            functor(value.u_set);
+            functor(value.u_band);
+            functor(value.line_drop_compensation_r);
+            functor(value.line_drop_compensation_x);
+    }
 };
 
 template <symmetry_tag sym_type>
@@ -210,6 +352,17 @@ struct get_attributes_list<CurrentSensorUpdate<sym_type>> {
             meta_data_gen::get_meta_attribute<&CurrentSensorUpdate<sym>::i_measured>(offsetof(CurrentSensorUpdate<sym>, i_measured), "i_measured"),
             meta_data_gen::get_meta_attribute<&CurrentSensorUpdate<sym>::i_angle_measured>(offsetof(CurrentSensorUpdate<sym>, i_angle_measured), "i_angle_measured"),
     };
+
+    // visit the values of all attributes in the order of the list above
+    // the member types and offsets are known at compile time
+    template <class Value, class Functor>
+    static constexpr void visit_values(Value& value, Functor&& functor) {
+            functor(value.id);
+            functor(value.i_sigma);
+            functor(value.i_angle_sigma);
+            functor(value.i_measured);
+            functor(value.i_angle_measured);
+    }
 };
 
 
@@ -172,6 +172,10 @@ struct NodeShortCircuitOutput {
     RealValue<asymmetric_t> u_pu{nan};  // initial three phase line-to-ground short circuit voltage magnitude and angle
     RealValue<asymmetric_t> u{nan};  // initial three phase line-to-ground short circuit voltage magnitude and angle
     RealValue<asymmetric_t> u_angle{nan};  // initial three phase line-to-ground short circuit voltage magnitude and angle
+    RealValue<asymmetric_t> i_f_three_phase{nan};  // fault scan only: current magnitude and angle of a bolted three phase fault at this node
+    RealValue<asymmetric_t> i_f_three_phase_angle{nan};  // fault scan only: current magnitude and angle of a bolted three phase fault at this node
+    RealValue<asymmetric_t> i_f_single_phase{nan};  // fault scan only: current of a bolted single phase to ground fault in each phase
+    RealValue<asymmetric_t> i_f_single_phase_angle{nan};  // fault scan only: current of a bolted single phase to ground fault in each phase
 
     // implicit conversions to BaseOutput
     operator BaseOutput&() { return reinterpret_cast<BaseOutput&>(*this); }
@@ -0,0 +1,413 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../common/common.hpp"
+#include "../../common/exception.hpp"
+#include "../dataset.hpp"
+#include "../meta_data.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Native columnar container of a dataset.
+//
+// The attribute arrays are stored in the same memory layout as columnar attribute buffers,
+//     so the data can be used in place without parsing, e.g. when the file is mapped into memory.
+// All integers are little-endian Idx (int64), all offsets are counted from the start of the data.
+// Every array starts at a multiple of 64 bytes.
+//
+//  header (64 bytes):
+//      magic "PGMCOLMN", format version, is_batch, batch_size, n_components,
+//      offset and size of the dataset name, total size
+//  component table (64 bytes per component):
+//      offset and size of the name, elements_per_scenario (-1 if not uniform), total_elements,
+//      offset of the indptr (0 if uniform), n_attributes, offset of the attribute table, reserved
+//  attribute table (32 bytes per attribute):
+//      offset and size of the name, ctype, offset of the data
+//  names
+//  per component: the indptr (batch_size + 1 values, if not uniform), then the attribute arrays
+//      an attribute array holds total_elements values of the ctype of the attribute
+namespace power_grid_model::meta_data::columnar_format {
+
+constexpr std::array<char, 8> magic{'P', 'G', 'M', 'C', 'O', 'L', 'M', 'N'};
+constexpr Idx format_version = 1;
+constexpr size_t alignment = 64;
+constexpr size_t header_size = 64;
+constexpr size_t component_entry_size = 64;
+constexpr size_t attribute_entry_size = 32;
+
+constexpr size_t aligned_offset(size_t offset) { return (offset + alignment - 1) / alignment * alignment; }
+
+inline void check_endianness() {
+    if constexpr (std::endian::native != std::endian::little) {
+        throw SerializationError{"The columnar format is only supported on little-endian platforms!\n"};
+    }
+}
+
+struct AttributeEntry {
+    MetaAttribute const* attribute{nullptr};
+    size_t name_offset{};
+    size_t data_offset{};
+};
+
+struct ComponentEntry {
+    MetaComponent const* component{nullptr};
+    Idx elements_per_scenario{};
+    Idx total_elements{};
+    size_t name_offset{};
+    size_t indptr_offset{};
+    size_t attribute_table_offset{};
+    std::vector<AttributeEntry> attributes;
+};
+
+struct Layout {
+    size_t dataset_name_offset{};
+    size_t total_size{};
+};
+
+// assign the offsets of all the blocks
+// the component, the number of elements and the attributes of the entries should be set
+inline Layout compute_layout(MetaDataset const& dataset, Idx batch_size, std::vector<ComponentEntry>& components) {
+    Layout layout{};
+    size_t offset = header_size + components.size() * component_entry_size;
+    for (auto& entry : components) {
+        entry.attribute_table_offset = offset;
+        offset += entry.attributes.size() * attribute_entry_size;
+    }
+    layout.dataset_name_offset = offset;
+    offset += std::string_view{dataset.name}.size();
+    for (auto& entry : components) {
+        entry.name_offset = offset;
+        offset += std::string_view{entry.component->name}.size();
+        for (auto& attribute_entry : entry.attributes) {
+            attribute_entry.name_offset = offset;
+            offset += std::string_view{attribute_entry.attribute->name}.size();
+        }
+    }
+    for (auto& entry : components) {
+        offset = aligned_offset(offset);
+        if (entry.elements_per_scenario < 0) {
+            entry.indptr_offset = offset;
+            offset = aligned_offset(offset + static_cast<size_t>(batch_size + 1) * sizeof(Idx));
+        } else {
+            entry.indptr_offset = 0;
+        }
+        for (auto& attribute_entry : entry.attributes) {
+            attribute_entry.data_offset = offset;
+            offset =
+                aligned_offset(offset + static_cast<size_t>(entry.total_elements) * attribute_entry.attribute->size);
+        }
+    }
+    layout.total_size = aligned_offset(offset);
+    return layout;
+}
+
+// write the container to a stream with the write(char const*, size_t) interface, keeping track of the position
+template <class Stream> class Writer {
+  public:
+    explicit Writer(Stream& stream) : stream_{&stream} { check_endianness(); }
+
+    // write everything in front of the first array, the layout should be computed
+    void write_header(MetaDataset const& dataset, bool is_batch, Idx batch_size,
+                      std::vector<ComponentEntry> const& components, Layout const& layout) {
+        write(magic.data(), magic.size());
+        write_idx(format_version);
+        write_idx(is_batch ? 1 : 0);
+        write_idx(batch_size);
+        write_idx(static_cast<Idx>(components.size()));
+        write_idx(static_cast<Idx>(layout.dataset_name_offset));
+        write_idx(static_cast<Idx>(std::string_view{dataset.name}.size()));
+        write_idx(static_cast<Idx>(layout.total_size));
+        for (auto const& entry : components) {
+            write_idx(static_cast<Idx>(entry.name_offset));
+            write_idx(static_cast<Idx>(std::string_view{entry.component->name}.size()));
+            write_idx(entry.elements_per_scenario);
+            write_idx(entry.total_elements);
+            write_idx(static_cast<Idx>(entry.indptr_offset));
+            write_idx(static_cast<Idx>(entry.attributes.size()));
+            write_idx(static_cast<Idx>(entry.attribute_table_offset));
+            write_idx(0);
+        }
+        for (auto const& entry : components) {
+            for (auto const& attribute_entry : entry.attributes) {
+                write_idx(static_cast<Idx>(attribute_entry.name_offset));
+                write_idx(static_cast<Idx>(std::string_view{attribute_entry.attribute->name}.size()));
+                write_idx(static_cast<Idx>(attribute_entry.attribute->ctype));
+                write_idx(static_cast<Idx>(attribute_entry.data_offset));
+            }
+        }
+        write(std::string_view{dataset.name});
+        for (auto const& entry : components) {
+            write(std::string_view{entry.component->name});
+            for (auto const& attribute_entry : entry.attributes) {
+                write(std::string_view{attribute_entry.attribute->name});
+            }
+        }
+    }
+
+    void write(char const* data, size_t size) {
+        stream_->write(data, size);
+        position_ += size;
+    }
+
+    void write(std::string_view str) { write(str.data(), str.size()); }
+
+    void write_idx(Idx value) { write(reinterpret_cast<char const*>(&value), sizeof(Idx)); }
+
+    // pad with zeros up to the offset of the next block
+    void pad_to(size_t offset) {
+        constexpr std::array<char, alignment> zeros{};
+        assert(offset >= position_);
+        while (position_ != offset) {
+            write(zeros.data(), std::min(zeros.size(), offset - position_));
+        }
+    }
+
+  private:
+    Stream* stream_;
+    size_t position_{0};
+};
+
+// read and validate the tables and the indptr of the container, the arrays themselves are not touched
+// the data should stay alive as long as the reader is used
+class Reader {
+    // look up a name in the meta data, an unknown name is a serialization error
+    template <class Meta> static auto const& find(Meta const& meta, std::string_view name) {
+        try {
+            if constexpr (std::same_as<Meta, MetaData>) {
+                return meta.get_dataset(name);
+            } else if constexpr (std::same_as<Meta, MetaDataset>) {
+                return meta.get_component(name);
+            } else {
+                return meta.get_attribute(name);
+            }
+        } catch (std::out_of_range const& e) {
+            throw SerializationError{e.what()};
+        }
+    }
+
+  public:
+    struct Attribute {
+        MetaAttribute const* attribute;
+        char const* data;
+    };
+
+    struct Component {
+        MetaComponent const* component;
+        Idx elements_per_scenario;
+        Idx total_elements;
+        char const* indptr_data; // nullptr if uniform
+        IdxVector indptr;        // empty if uniform
+        std::vector<Attribute> attributes;
+    };
+
+    Reader(std::span<char const> data, MetaData const& meta_data) : data_{data} {
+        check_endianness();
+        auto const header = get_block(0, header_size);
+        if (!std::equal(magic.begin(), magic.end(), header.begin())) {
+            throw SerializationError{"The data is not in the columnar format!\n"};
+        }
+        if (Idx const version = read_idx(magic.size()); version != format_version) {
+            throw SerializationError{"Unsupported version of the columnar format: " + std::to_string(version) +
+                                     "!\n"};
+        }
+        is_batch_ = read_idx(16) != 0;
+        batch_size_ = read_idx(24);
+        if (batch_size_ < 0 || (!is_batch_ && batch_size_ != 1)) {
+            throw SerializationError{"Invalid batch size in columnar data!\n"};
+        }
+        Idx const n_components = read_idx(32);
+        dataset_ = &find(meta_data, read_string(40));
+        if (read_idx(56) != static_cast<Idx>(data_.size())) {
+            throw SerializationError{"The size of the columnar data does not match its header!\n"};
+        }
+
+        get_block(header_size, to_size(n_components) * component_entry_size);
+        components_.reserve(to_size(n_components));
+        for (Idx i = 0; i != n_components; ++i) {
+            components_.push_back(read_component(header_size + to_size(i) * component_entry_size));
+        }
+    }
+
+    bool is_batch() const { return is_batch_; }
+    Idx batch_size() const { return batch_size_; }
+    MetaDataset const& dataset() const { return *dataset_; }
+    std::span<Component const> components() const { return components_; }
+
+    // number of elements per scenario of all scenarios
+    IdxVector elements_per_scenario(Component const& component) const {
+        if (component.elements_per_scenario >= 0) {
+            return IdxVector(to_size(batch_size_), component.elements_per_scenario);
+        }
+        IdxVector counter(to_size(batch_size_));
+        std::adjacent_difference(component.indptr.begin() + 1, component.indptr.end(), counter.begin());
+        return counter;
+    }
+
+    // index of the first element of a scenario
+    static Idx element_offset(Component const& component, Idx scenario) {
+        if (component.elements_per_scenario >= 0) {
+            return component.elements_per_scenario * scenario;
+        }
+        return component.indptr[to_size(scenario)];
+    }
+
+    // copy the elements [begin, begin + size) to a row based or columnar buffer
+    // attributes that are not present in the buffer or in the data are skipped
+    template <class Buffer> static void copy_to(Component const& component, Idx begin, Idx size, Buffer const& buffer) {
+        if (buffer.data != nullptr) {
+            for (auto const& [attribute, data] : component.attributes) {
+                ctype_func_selector(attribute->ctype, [&]<class T> {
+                    // the data may be unaligned, so it is copied bytewise into a value first
+                    T value{};
+                    for (Idx element = 0; element != size; ++element) {
+                        std::memcpy(static_cast<void*>(&value), data + static_cast<size_t>(begin + element) * sizeof(T),
+                                    sizeof(T));
+                        attribute->template get_attribute<T>(component.component->advance_ptr(buffer.data, element)) =
+                            value;
+                    }
+                });
+            }
+            return;
+        }
+        for (auto const& attribute_buffer : buffer.attributes) {
+            auto const found = std::ranges::find_if(component.attributes, [&attribute_buffer](auto const& x) {
+                return x.attribute == attribute_buffer.meta_attribute;
+            });
+            if (attribute_buffer.data != nullptr && found != component.attributes.end()) {
+                std::memcpy(attribute_buffer.data, found->data + static_cast<size_t>(begin) * found->attribute->size,
+                            static_cast<size_t>(size) * found->attribute->size);
+            }
+        }
+    }
+
+    // a dataset referring directly to the arrays in the data, without copying
+    ConstDataset create_const_dataset(MetaData const& meta_data) const {
+        ConstDataset dataset{is_batch_, batch_size_, dataset_->name, meta_data};
+        for (auto const& component : components_) {
+            check_aligned(component.indptr_data);
+            dataset.add_buffer(component.component->name, component.elements_per_scenario, component.total_elements,
+                               reinterpret_cast<Idx const*>(component.indptr_data), nullptr);
+            for (auto const& [attribute, data] : component.attributes) {
+                check_aligned(data);
+                dataset.add_attribute_buffer(component.component->name, attribute->name, data);
+            }
+        }
+        return dataset;
+    }
+
+  private:
+    std::span<char const> data_;
+    bool is_batch_{};
+    Idx batch_size_{};
+    MetaDataset const* dataset_{nullptr};
+    std::vector<Component> components_;
+
+    static size_t to_size(Idx value) {
+        if (value < 0) {
+            throw SerializationError{"Negative size or offset in columnar data!\n"};
+        }
+        return static_cast<size_t>(value);
+    }
+
+    std::span<char const> get_block(size_t offset, size_t size) const {
+        if (offset > data_.size() || size > data_.size() - offset) {
+            throw SerializationError{"The columnar data is truncated or corrupted!\n"};
+        }
+        return data_.subspan(offset, size);
+    }
+
+    Idx read_idx(size_t offset) const {
+        Idx value{};
+        std::memcpy(&value, get_block(offset, sizeof(Idx)).data(), sizeof(Idx));
+        return value;
+    }
+
+    // read the offset and the size of a name at the offset
+    std::string_view read_string(size_t offset) const {
+        auto const block = get_block(to_size(read_idx(offset)), to_size(read_idx(offset + sizeof(Idx))));
+        return {block.data(), block.size()};
+    }
+
+    // the array should start at an aligned offset
+    char const* get_array(size_t offset, size_t size) const {
+        if (offset % alignment != 0) {
+            throw SerializationError{"Misaligned array in columnar data!\n"};
+        }
+        return get_block(offset, size).data();
+    }
+
+    Component read_component(size_t entry_offset) const {
+        using namespace std::string_literals;
+
+        MetaComponent const& meta_component = find(*dataset_, read_string(entry_offset));
+        Component component{.component = &meta_component,
+                            .elements_per_scenario = read_idx(entry_offset + 16),
+                            .total_elements = read_idx(entry_offset + 24),
+                            .indptr_data = nullptr,
+                            .indptr = {},
+                            .attributes = {}};
+        if (std::ranges::any_of(components_, [&](auto const& x) { return x.component == &meta_component; })) {
+            throw SerializationError{"Duplicated component in columnar data: "s + meta_component.name + "!\n"s};
+        }
+        size_t const total_elements = to_size(component.total_elements);
+        if (component.elements_per_scenario >= 0) {
+            if (component.elements_per_scenario * batch_size_ != component.total_elements) {
+                throw SerializationError{"Inconsistent number of elements in columnar data: "s + meta_component.name +
+                                         "!\n"s};
+            }
+        } else {
+            size_t const indptr_size = to_size(batch_size_) + 1;
+            component.indptr_data = get_array(to_size(read_idx(entry_offset + 32)), indptr_size * sizeof(Idx));
+            component.indptr.resize(indptr_size);
+            std::memcpy(component.indptr.data(), component.indptr_data, indptr_size * sizeof(Idx));
+            if (component.indptr.front() != 0 || component.indptr.back() != component.total_elements ||
+                !std::ranges::is_sorted(component.indptr)) {
+                throw SerializationError{"Invalid indptr in columnar data: "s + meta_component.name + "!\n"s};
+            }
+        }
+
+        size_t const n_attributes = to_size(read_idx(entry_offset + 40));
+        size_t const table_offset = to_size(read_idx(entry_offset + 48));
+        get_block(table_offset, n_attributes * attribute_entry_size);
+        for (size_t i = 0; i != n_attributes; ++i) {
+            size_t const attribute_offset = table_offset + i * attribute_entry_size;
+            MetaAttribute const& attribute = find(meta_component, read_string(attribute_offset));
+            if (read_idx(attribute_offset + 16) != static_cast<Idx>(attribute.ctype)) {
+                throw SerializationError{"Wrong data type in columnar data: "s + meta_component.name + "/"s +
+                                         attribute.name + "!\n"s};
+            }
+            if (std::ranges::any_of(component.attributes, [&](auto const& x) { return x.attribute == &attribute; })) {
+                throw SerializationError{"Duplicated attribute in columnar data: "s + meta_component.name + "/"s +
+                                         attribute.name + "!\n"s};
+            }
+            component.attributes.push_back(
+                {.attribute = &attribute,
+                 .data = get_array(to_size(read_idx(attribute_offset + 24)), total_elements * attribute.size)});
+        }
+        return component;
+    }
+
+    static void check_aligned(char const* data) {
+        if (reinterpret_cast<std::uintptr_t>(data) % alignof(std::max_align_t) != 0) {
+            throw SerializationError{
+                "The columnar data is not aligned in memory and cannot be used in place, it should be copied!\n"};
+        }
+    }
+};
+
+} // namespace power_grid_model::meta_data::columnar_format
@@ -6,9 +6,13 @@
 
 #include "../dataset.hpp"
 
+#include <algorithm>
 #include <concepts>
+#include <iterator>
 #include <ranges>
 #include <span>
+#include <type_traits>
+#include <vector>
 
 namespace power_grid_model::meta_data::detail {
 
@@ -23,6 +27,37 @@ concept row_based_or_columnar_c = std::derived_from<T, row_based_t> || std::deri
 template <row_based_or_columnar_c T> constexpr bool is_row_based_v = std::derived_from<T, row_based_t>;
 template <row_based_or_columnar_c T> constexpr bool is_columnar_v = std::derived_from<T, columnar_t>;
 
+// the value as the type of its ctype, e.g. an enum as its underlying type, like the ctype function selector
+template <class T> auto& ctype_value(T& value) {
+    using ValueType = std::remove_const_t<T>;
+    using CTypeValueType =
+        std::conditional_t<std::is_const_v<T>, ctype_type_t<ValueType> const, ctype_type_t<ValueType>>;
+    if constexpr (std::same_as<ValueType, ctype_type_t<ValueType>>) {
+        return value;
+    } else {
+        return reinterpret_cast<CTypeValueType&>(value);
+    }
+}
+
+// mark which attributes of the component are present in the list of attributes
+// the result is empty if the list is not in the default order of the component, the kernel cannot be used then
+inline std::vector<bool> select_attributes_in_default_order(MetaComponent const& component,
+                                                           std::span<MetaAttribute const* const> attributes) {
+    std::vector<bool> selected(component.attributes.size(), false);
+    size_t position{};
+    for (auto const* const attribute : attributes) {
+        auto const found = std::ranges::find_if(component.attributes.subspan(position),
+                                                [attribute](auto const& x) { return &x == attribute; });
+        if (found == component.attributes.end()) {
+            return {};
+        }
+        position = static_cast<size_t>(std::distance(component.attributes.begin(), found));
+        selected[position] = true;
+        ++position;
+    }
+    return selected;
+}
+
 // obtain attribute buffers of a columnar dataset buffer, ordered by the provided meta attributes.
 //
 // If none of the provided meta attributes are present in the provided attribute buffers, the result is empty.
@@ -4,23 +4,36 @@
 
 #pragma once
 
+#include "columnar_format.hpp"
 #include "common.hpp"
+#include "mapped_file.hpp"
 
 #include "../../common/common.hpp"
 #include "../../common/exception.hpp"
 #include "../../common/typing.hpp"
 #include "../dataset.hpp"
 #include "../meta_data.hpp"
+#include "../meta_data_gen.hpp"
 
 #include <nlohmann/json.hpp>
 
 #include <msgpack.hpp>
 
+#include <algorithm>
+#include <charconv>
+#include <clocale>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <optional>
 #include <set>
 #include <span>
 #include <sstream>
 #include <stack>
 #include <string_view>
+#include <thread>
 #include <utility>
 
 namespace power_grid_model::meta_data {
@@ -37,6 +50,12 @@ constexpr from_msgpack_t from_msgpack;
 struct from_json_t {};
 constexpr from_json_t from_json;
 
+struct from_file_t {};
+constexpr from_file_t from_file;
+
+struct from_columnar_t {};
+constexpr from_columnar_t from_columnar;
+
 namespace detail {
 
 using nlohmann::json;
@@ -160,6 +179,125 @@ struct CheckHasMap : DefaultNullVisitor {
     }
 };
 
+// skip a msgpack value by its type byte and size headers, without visiting the content
+// the strings are jumped over, only the containers are counted
+// returns whether the value contains a map
+inline bool skip_msgpack_value(char const* data, size_t size, size_t& offset) {
+    size_t const start = offset;
+    auto const require = [data, size, start, &offset](size_t n_bytes) {
+        if (n_bytes > size - offset) {
+            throw SerializationError{DefaultNullVisitor::msg_for_parse_error(start, offset, "Insufficient bytes")};
+        }
+        return reinterpret_cast<unsigned char const*>(data + offset);
+    };
+    // big-endian length of the size header
+    auto const read_length = [&require](size_t header_size, size_t n_length_bytes) {
+        unsigned char const* const bytes = require(header_size) + 1;
+        uint64_t length{};
+        for (size_t i = 0; i != n_length_bytes; ++i) {
+            length = (length << 8U) | bytes[i];
+        }
+        return length;
+    };
+
+    bool has_map{false};
+    uint64_t pending = 1;
+    while (pending-- != 0) {
+        uint8_t const type = *require(1);
+        size_t value_size{};
+        if (type <= 0x7fU || type >= 0xe0U || type == 0xc0U || type == 0xc2U || type == 0xc3U) {
+            value_size = 1; // fixint, nil, bool
+        } else if (type <= 0x8fU) {
+            has_map = true;
+            pending += 2 * uint64_t{type & 0x0fU};
+            value_size = 1;
+        } else if (type <= 0x9fU) {
+            pending += type & 0x0fU;
+            value_size = 1;
+        } else if (type <= 0xbfU) {
+            value_size = 1 + size_t{type & 0x1fU};
+        } else {
+            switch (type) {
+            case 0xc4U: // bin 8
+            case 0xd9U: // str 8
+                value_size = 2 + read_length(2, 1);
+                break;
+            case 0xc5U: // bin 16
+            case 0xdaU: // str 16
+                value_size = 3 + read_length(3, 2);
+                break;
+            case 0xc6U: // bin 32
+            case 0xdbU: // str 32
+                value_size = 5 + read_length(5, 4);
+                break;
+            case 0xc7U: // ext 8
+                value_size = 3 + read_length(2, 1);
+                break;
+            case 0xc8U: // ext 16
+                value_size = 4 + read_length(3, 2);
+                break;
+            case 0xc9U: // ext 32
+                value_size = 6 + read_length(5, 4);
+                break;
+            case 0xccU: // uint 8
+            case 0xd0U: // int 8
+                value_size = 2;
+                break;
+            case 0xcdU: // uint 16
+            case 0xd1U: // int 16
+            case 0xd4U: // fixext 1
+                value_size = 3;
+                break;
+            case 0xd5U: // fixext 2
+                value_size = 4;
+                break;
+            case 0xcaU: // float 32
+            case 0xceU: // uint 32
+            case 0xd2U: // int 32
+                value_size = 5;
+                break;
+            case 0xd6U: // fixext 4
+                value_size = 6;
+                break;
+            case 0xcbU: // float 64
+            case 0xcfU: // uint 64
+            case 0xd3U: // int 64
+                value_size = 9;
+                break;
+            case 0xd7U: // fixext 8
+                value_size = 10;
+                break;
+            case 0xd8U: // fixext 16
+                value_size = 18;
+                break;
+            case 0xdcU: // array 16
+                pending += read_length(3, 2);
+                value_size = 3;
+                break;
+            case 0xddU: // array 32
+                pending += read_length(5, 4);
+                value_size = 5;
+                break;
+            case 0xdeU: // map 16
+                has_map = true;
+                pending += 2 * read_length(3, 2);
+                value_size = 3;
+                break;
+            case 0xdfU: // map 32
+                has_map = true;
+                pending += 2 * read_length(5, 4);
+                value_size = 5;
+                break;
+            default: // 0xc1 is never used
+                throw SerializationError{DefaultNullVisitor::msg_for_parse_error(start, offset, "Error in parsing")};
+            }
+        }
+        require(value_size);
+        offset += value_size;
+    }
+    return has_map;
+}
+
 template <class T> struct DefaultErrorVisitor : DefaultNullVisitor {
     static constexpr std::string_view static_err_msg = "Unexpected data type!\n";
 
@@ -375,6 +513,367 @@ template <> struct ValueVisitor<RealValue<asymmetric_t>> : DefaultErrorVisitor<V
     ValueVisitor(RealValue<asymmetric_t>& v) : DefaultErrorVisitor<ValueVisitor<RealValue<asymmetric_t>>>{}, value{v} {}
 };
 
+// reader of json text, which calls the same visitors as msgpack::parse
+// a structural scan in advance records the number of elements of every map and array,
+//     as msgpack has them in the header of a map/array
+// the values are converted when they are visited, so they are directly written into the buffers
+// the scan only accepts json of which the strings can be viewed in the text,
+//     i.e. without escape sequences and non-ASCII characters
+//     other json is converted to msgpack instead, which also reports the syntax errors
+class JsonReader {
+  public:
+    // nullopt if the json is not valid or not supported by the reader
+    static std::optional<JsonReader> create(std::string_view json) {
+        JsonReader reader{json};
+        if (!reader.scan()) {
+            return std::nullopt;
+        }
+        return reader;
+    }
+
+    // parse a single value starting from the offset, the offset is moved to the end of the parsed data
+    template <class Visitor> void parse(size_t& offset, Visitor& visitor) { parse_value(offset, visitor); }
+
+  private:
+    struct Container {
+        size_t begin{};
+        size_t end{};
+        size_t size{};
+        bool is_map{};
+        bool has_map{}; // the container is a map or has a map inside
+    };
+
+    std::string_view json_;
+    // all maps and arrays, in order of their beginning
+    // shared by the copies of the reader, it is read only after the scan
+    std::shared_ptr<std::vector<Container>> containers_{std::make_shared<std::vector<Container>>()};
+    // maps and arrays are mostly visited in order, so the next one is tried first
+    size_t next_container_{};
+    // null terminated copy of a floating point number
+    std::string number_buffer_;
+
+    explicit JsonReader(std::string_view json) : json_{json} {}
+
+    static constexpr bool is_whitespace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+    static constexpr bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+    void skip_whitespace(size_t& pos) const {
+        while (pos != json_.size() && is_whitespace(json_[pos])) {
+            ++pos;
+        }
+    }
+
+    bool scan_literal(size_t& pos, std::string_view literal) const {
+        if (json_.substr(pos, literal.size()) != literal) {
+            return false;
+        }
+        pos += literal.size();
+        return true;
+    }
+
+    bool scan_string(size_t& pos) const {
+        assert(json_[pos] == '"');
+        for (++pos; pos != json_.size(); ++pos) {
+            auto const c = static_cast<unsigned char>(json_[pos]);
+            if (c == '"') {
+                ++pos;
+                return true;
+            }
+            if (c == '\\' || c < 0x20 || c >= 0x80) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool scan_digits(size_t& pos) const {
+        size_t const begin = pos;
+        while (pos != json_.size() && is_digit(json_[pos])) {
+            ++pos;
+        }
+        return pos != begin;
+    }
+
+    bool scan_number(size_t& pos) const {
+        if (json_[pos] == '-') {
+            ++pos;
+        }
+        if (pos != json_.size() && json_[pos] == '0') {
+            ++pos;
+        } else if (!scan_digits(pos)) {
+            return false;
+        }
+        if (pos != json_.size() && json_[pos] == '.') {
+            ++pos;
+            if (!scan_digits(pos)) {
+                return false;
+            }
+        }
+        if (pos != json_.size() && (json_[pos] == 'e' || json_[pos] == 'E')) {
+            ++pos;
+            if (pos != json_.size() && (json_[pos] == '+' || json_[pos] == '-')) {
+                ++pos;
+            }
+            if (!scan_digits(pos)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool scan_scalar(size_t& pos) const {
+        switch (json_[pos]) {
+        case '"':
+            return scan_string(pos);
+        case 't':
+            return scan_literal(pos, "true");
+        case 'f':
+            return scan_literal(pos, "false");
+        case 'n':
+            return scan_literal(pos, "null");
+        default:
+            return scan_number(pos);
+        }
+    }
+
+    bool close_container(size_t& pos, std::vector<size_t>& open_containers) {
+        Container& container = (*containers_)[open_containers.back()];
+        if (json_[pos] != (container.is_map ? '}' : ']') || !std::in_range<uint32_t>(container.size)) {
+            return false;
+        }
+        container.end = ++pos;
+        bool const has_map = container.has_map;
+        open_containers.pop_back();
+        if (!open_containers.empty()) {
+            (*containers_)[open_containers.back()].has_map |= has_map;
+        }
+        return true;
+    }
+
+    // check the syntax and record the size of all maps and arrays
+    bool scan() {
+        enum class Expect : uint8_t { value, value_or_end, key, key_or_end, separator_or_end };
+
+        std::vector<size_t> open_containers;
+        size_t pos{};
+        skip_whitespace(pos);
+        // the root should be a map, the conversion to msgpack reports it otherwise
+        if (pos == json_.size() || json_[pos] != '{') {
+            return false;
+        }
+        Expect expect = Expect::value;
+        while (true) {
+            skip_whitespace(pos);
+            if (pos == json_.size()) {
+                return open_containers.empty() && expect == Expect::separator_or_end;
+            }
+            if (open_containers.empty() && expect == Expect::separator_or_end) {
+                return false; // trailing data after the root
+            }
+            char const c = json_[pos];
+            switch (expect) {
+            case Expect::value_or_end:
+                if (c == ']') {
+                    if (!close_container(pos, open_containers)) {
+                        return false;
+                    }
+                    expect = Expect::separator_or_end;
+                    continue;
+                }
+                [[fallthrough]];
+            case Expect::value:
+                if (!open_containers.empty() && !(*containers_)[open_containers.back()].is_map) {
+                    ++(*containers_)[open_containers.back()].size;
+                }
+                if (c == '{' || c == '[') {
+                    open_containers.push_back(containers_->size());
+                    containers_->push_back({.begin = pos, .is_map = c == '{', .has_map = c == '{'});
+                    ++pos;
+                    expect = c == '{' ? Expect::key_or_end : Expect::value_or_end;
+                    continue;
+                }
+                if (!scan_scalar(pos)) {
+                    return false;
+                }
+                expect = Expect::separator_or_end;
+                continue;
+            case Expect::key_or_end:
+                if (c == '}') {
+                    if (!close_container(pos, open_containers)) {
+                        return false;
+                    }
+                    expect = Expect::separator_or_end;
+                    continue;
+                }
+                [[fallthrough]];
+            case Expect::key:
+                if (c != '"' || !scan_string(pos)) {
+                    return false;
+                }
+                ++(*containers_)[open_containers.back()].size;
+                skip_whitespace(pos);
+                if (pos == json_.size() || json_[pos] != ':') {
+                    return false;
+                }
+                ++pos;
+                expect = Expect::value;
+                continue;
+            case Expect::separator_or_end:
+                if (c == ',') {
+                    ++pos;
+                    expect = (*containers_)[open_containers.back()].is_map ? Expect::key : Expect::value;
+                    continue;
+                }
+                if (!close_container(pos, open_containers)) {
+                    return false;
+                }
+                continue;
+            }
+        }
+    }
+
+    Container const& find_container(size_t pos) {
+        if (next_container_ == containers_->size() || (*containers_)[next_container_].begin != pos) {
+            auto const found = std::ranges::lower_bound(*containers_, pos, {}, &Container::begin);
+            assert(found != containers_->end() && found->begin == pos);
+            next_container_ = static_cast<size_t>(std::distance(containers_->begin(), found));
+        }
+        return (*containers_)[next_container_++];
+    }
+
+    // the separators and the ends of maps and arrays are skipped, because the sizes are known in advance
+    void skip_separators(size_t& pos) const {
+        while (pos != json_.size() && (is_whitespace(json_[pos]) || json_[pos] == ',' || json_[pos] == ':' ||
+                                       json_[pos] == ']' || json_[pos] == '}')) {
+            ++pos;
+        }
+    }
+
+    template <class Visitor> bool parse_value(size_t& pos, Visitor& visitor) {
+        skip_separators(pos);
+        assert(pos != json_.size());
+        switch (json_[pos]) {
+        case '{':
+            [[fallthrough]];
+        case '[':
+            return parse_container(pos, visitor);
+        case '"':
+            return parse_string(pos, visitor);
+        case 't':
+            pos += std::string_view{"true"}.size();
+            return visitor.visit_boolean(true);
+        case 'f':
+            pos += std::string_view{"false"}.size();
+            return visitor.visit_boolean(false);
+        case 'n':
+            pos += std::string_view{"null"}.size();
+            return visitor.visit_nil();
+        default:
+            return parse_number(pos, visitor);
+        }
+    }
+
+    template <class Visitor> bool parse_container(size_t& pos, Visitor& visitor) {
+        Container const& container = find_container(pos);
+        size_t const end = container.end;
+        auto const size = static_cast<uint32_t>(container.size);
+        // skipping does not need to visit the content
+        if constexpr (std::same_as<Visitor, DefaultNullVisitor>) {
+            pos = end;
+            return true;
+        } else if constexpr (std::same_as<Visitor, CheckHasMap>) {
+            visitor.has_map = visitor.has_map || container.has_map;
+            pos = end;
+            return true;
+        } else {
+            bool const is_map = container.is_map;
+            ++pos;
+            if (is_map) {
+                if (!visitor.start_map(size)) {
+                    return false;
+                }
+                for (uint32_t idx = 0; idx != size; ++idx) {
+                    if (!visitor.start_map_key() || !parse_value(pos, visitor) || !visitor.end_map_key() ||
+                        !visitor.start_map_value() || !parse_value(pos, visitor) || !visitor.end_map_value()) {
+                        return false;
+                    }
+                }
+                if (!visitor.end_map()) {
+                    return false;
+                }
+            } else {
+                if (!visitor.start_array(size)) {
+                    return false;
+                }
+                for (uint32_t idx = 0; idx != size; ++idx) {
+                    if (!visitor.start_array_item() || !parse_value(pos, visitor) || !visitor.end_array_item()) {
+                        return false;
+                    }
+                }
+                if (!visitor.end_array()) {
+                    return false;
+                }
+            }
+            pos = end;
+            return true;
+        }
+    }
+
+    template <class Visitor> bool parse_string(size_t& pos, Visitor& visitor) {
+        size_t const begin = pos + 1;
+        size_t const end = json_.find('"', begin);
+        assert(end != std::string_view::npos);
+        std::string_view const str = json_.substr(begin, end - begin);
+        pos = end + 1;
+        // infinity is written as a string value, but not as a key
+        if (str == "inf" || str == "+inf" || str == "-inf") {
+            size_t next = pos;
+            skip_whitespace(next);
+            if (next == json_.size() || json_[next] != ':') {
+                return visitor.visit_float64(str == "-inf" ? -std::numeric_limits<double>::infinity()
+                                                           : std::numeric_limits<double>::infinity());
+            }
+        }
+        return visitor.visit_str(str.data(), static_cast<uint32_t>(str.size()));
+    }
+
+    template <class Visitor> bool parse_number(size_t& pos, Visitor& visitor) {
+        size_t const begin = pos;
+        bool is_integer = true;
+        while (pos != json_.size() && (is_digit(json_[pos]) || json_[pos] == '-' || json_[pos] == '+' ||
+                                       json_[pos] == '.' || json_[pos] == 'e' || json_[pos] == 'E')) {
+            is_integer = is_integer && (is_digit(json_[pos]) || json_[pos] == '-');
+            ++pos;
+        }
+        std::string_view const number = json_.substr(begin, pos - begin);
+        // integers out of range are floating point numbers, as in the json conversion
+        if (is_integer) {
+            if (number.front() == '-') {
+                int64_t value{};
+                if (std::from_chars(number.data(), number.data() + number.size(), value).ec == std::errc{}) {
+                    return value < 0 ? visitor.visit_negative_integer(value)
+                                     : visitor.visit_positive_integer(static_cast<uint64_t>(value));
+                }
+            } else {
+                uint64_t value{};
+                if (std::from_chars(number.data(), number.data() + number.size(), value).ec == std::errc{}) {
+                    return visitor.visit_positive_integer(value);
+                }
+            }
+        }
+        return visitor.visit_float64(to_double(number));
+    }
+
+    // strtod as in the json conversion, with the decimal point of the current locale
+    double to_double(std::string_view number) {
+        number_buffer_.assign(number);
+        if (char const decimal_point = *std::localeconv()->decimal_point; decimal_point != '.') {
+            std::ranges::replace(number_buffer_, '.', decimal_point);
+        }
+        return std::strtod(number_buffer_.c_str(), nullptr);
+    }
+};
+
 } // namespace detail
 
 class Deserializer {
@@ -390,6 +889,7 @@ class Deserializer {
     using visit_array_t = detail::visit_array_t;
     using visit_map_array_t = detail::visit_map_array_t;
     using JsonSAXVisitor = detail::JsonSAXVisitor;
+    using JsonReader = detail::JsonReader;
 
     struct ComponentByteMeta {
         std::string_view component;
@@ -412,6 +912,18 @@ class Deserializer {
     static constexpr auto row_based = detail::row_based;
     static constexpr auto columnar = detail::columnar;
 
+    // row based buffer of which the array elements are parsed by the generated kernel of the component,
+    //     with the member types and offsets known at compile time, instead of per attribute through the meta data
+    // the kernel is used if the predefined attributes are in the default order of the component,
+    //     it marks which attributes of the component are predefined
+    struct RowBasedKernel : row_based_t {
+        std::vector<bool> const* selected{};
+        void (Deserializer::*parse_values)(BufferView const&, std::vector<bool> const&){};
+    };
+
+    struct parallel_worker_t {};
+    static constexpr parallel_worker_t parallel_worker{};
+
   public:
     // not copyable
     Deserializer(Deserializer const&) = delete;
@@ -431,12 +943,21 @@ class Deserializer {
                  MetaData const& meta_data)
         : Deserializer{create_from_format(data_buffer, serialization_format, meta_data)} {}
 
+    // the json is copied and read directly if possible, so the caller can release it after construction
+    // the copy has the size of the text, it replaces the msgpack buffer of the conversion
+    // if the json cannot be read directly, it is converted to msgpack and the copy is released
     Deserializer(from_json_t /* tag */, std::string_view json_string, MetaData const& meta_data)
         : meta_data_{&meta_data},
-          buffer_from_json_{json_to_msgpack(json_string)},
-          data_{buffer_from_json_.data()},
-          size_{buffer_from_json_.size()},
-          dataset_handler_{pre_parse()} {}
+          json_data_{json_string.begin(), json_string.end()},
+          json_reader_{JsonReader::create({json_data_.data(), json_data_.size()})},
+          buffer_from_json_{json_reader_.has_value() ? msgpack::sbuffer{} : json_to_msgpack(json_string)},
+          data_{json_reader_.has_value() ? json_data_.data() : buffer_from_json_.data()},
+          size_{json_reader_.has_value() ? json_data_.size() : buffer_from_json_.size()},
+          dataset_handler_{pre_parse()} {
+        if (!json_reader_.has_value()) {
+            json_data_ = {};
+        }
+    }
 
     Deserializer(from_msgpack_t /* tag */, std::span<char const> msgpack_data, MetaData const& meta_data)
         : meta_data_{&meta_data},
@@ -444,25 +965,90 @@ class Deserializer {
           size_{msgpack_data.size()},
           dataset_handler_{pre_parse()} {}
 
+    // the columnar data is used in place, it should stay alive as long as the deserializer
+    Deserializer(from_columnar_t /* tag */, std::span<char const> columnar_data, MetaData const& meta_data)
+        : meta_data_{&meta_data},
+          columnar_reader_{std::in_place, columnar_data, meta_data},
+          data_{columnar_data.data()},
+          size_{columnar_data.size()},
+          dataset_handler_{pre_parse_columnar()} {}
+
+    // the file is mapped into memory and owned by the deserializer
+    Deserializer(from_file_t /* tag */, std::filesystem::path const& file_path,
+                 SerializationFormat serialization_format, MetaData const& meta_data)
+        : Deserializer{create_from_format(MappedFile{file_path}, serialization_format, meta_data)} {}
+
     WritableDataset& get_dataset_info() { return dataset_handler_; }
 
-    void parse() {
-        root_key_ = "data";
-        try {
-            for (Idx i = 0; i != dataset_handler_.n_components(); ++i) {
-                parse_component(i);
+    // restrict the dataset to a window of consecutive scenarios, which is parsed by the next call to parse()
+    // the dataset info is updated in place to describe only these scenarios, the buffers have to be set again
+    // in this way a large batch can be parsed chunk by chunk into bounded buffers
+    void select_scenarios(Idx first_scenario, Idx n_scenarios) {
+        if (first_scenario < 0 || n_scenarios < 0 || first_scenario + n_scenarios > total_batch_size_) {
+            throw SerializationError{"Selected scenarios are out of range of the batch!\n"};
+        }
+        if (!is_batch_ && n_scenarios != 1) {
+            throw SerializationError{"A single dataset should select exactly one scenario!\n"};
+        }
+
+        WritableDataset handler{is_batch_, n_scenarios, dataset_handler_.dataset().name, *meta_data_};
+        for (Idx i = 0; i != dataset_handler_.n_components(); ++i) {
+            ComponentInfo const& info = dataset_handler_.get_component_info(i);
+            auto const selected = selected_msg_data(i, first_scenario, n_scenarios);
+            IdxVector counter(n_scenarios);
+            std::ranges::transform(selected, counter.begin(), [](auto const& x) { return x.size; });
+            add_component_info(handler, info.component->name, counter);
+            if (info.has_attribute_indications) {
+                handler.enable_attribute_indications(info.component->name);
+                if (auto const it = attributes_.find(info.component); it != attributes_.end()) {
+                    handler.set_attribute_indications(info.component->name, it->second);
+                }
             }
-        } catch (std::exception& e) {
-            handle_error(e);
         }
-        root_key_ = {};
+        dataset_handler_ = std::move(handler);
+        first_scenario_ = first_scenario;
+    }
+
+    // create a dataset referring directly to the arrays of columnar data, without copying
+    // it holds all the scenarios, regardless of select_scenarios(), and should not outlive the deserializer
+    // the data should be aligned in memory, which is the case for a mapped file
+    ConstDataset create_columnar_dataset() const {
+        if (!columnar_reader_.has_value()) {
+            throw SerializationError{"Only data in the columnar format can be used in place!\n"};
+        }
+        return columnar_reader_->create_const_dataset(*meta_data_);
+    }
+
+    // number of threads to parse the scenarios of a batch, in the same way as the threading of the calculation
+    //    < 0 or 1: sequential
+    //    0: use the number of hardware threads
+    //    > 1: use this number of threads
+    void set_threading(Idx threading) { threading_ = threading; }
+
+    void parse() {
+        for (Idx i = 0; i != dataset_handler_.n_components(); ++i) {
+            prepare_component(i);
+        }
+        if (columnar_reader_.has_value()) {
+            parse_columnar();
+        } else if (Idx const n_threads = get_n_threads(); n_threads > 1) {
+            parse_parallel(n_threads);
+        } else {
+            parse_scenarios(0, dataset_handler_.batch_size());
+        }
     }
 
   private:
     // data members are order dependent
     // DO NOT modify the order!
     MetaData const* meta_data_;
-    // own buffer if from json
+    // own copy of the json, if it can be read directly, the buffer does not move with the deserializer
+    std::vector<char> json_data_;
+    // reader of the json, if it can be read directly
+    std::optional<JsonReader> json_reader_;
+    // reader of the tables, if the data is in the columnar format
+    std::optional<columnar_format::Reader> columnar_reader_;
+    // own buffer if from json, which cannot be read directly
     msgpack::sbuffer buffer_from_json_;
     // pointer to buffers
     char const* data_;
@@ -480,6 +1066,10 @@ class Deserializer {
     // class members
     std::string version_;
     bool is_batch_{};
+    // number of scenarios in the data and the first of the selected scenarios, see select_scenarios()
+    Idx total_batch_size_{};
+    Idx first_scenario_{};
+    Idx threading_{-1};
     std::map<MetaComponent const*, std::vector<MetaAttribute const*>, std::less<>> attributes_;
 
     // offset of the msgpack bytes, the number of elements,
@@ -487,6 +1077,35 @@ class Deserializer {
     // if a component has no element for a certain scenario, that offset and size will be zero.
     std::vector<std::vector<ComponentByteMeta>> msg_data_offsets_;
     WritableDataset dataset_handler_;
+    // own memory mapping if from file
+    MappedFile mapped_file_;
+
+    // a copy of the parsing state, to parse part of the scenarios on another thread
+    // the serialized data and the user buffers are shared with the original
+    Deserializer(parallel_worker_t /* tag */, Deserializer const& other)
+        : meta_data_{other.meta_data_},
+          json_reader_{other.json_reader_},
+          data_{other.data_},
+          size_{other.size_},
+          is_batch_{other.is_batch_},
+          total_batch_size_{other.total_batch_size_},
+          first_scenario_{other.first_scenario_},
+          attributes_{other.attributes_},
+          msg_data_offsets_{other.msg_data_offsets_},
+          dataset_handler_{other.dataset_handler_} {}
+
+    // the json in a mapped file is read in place, without a copy, as the deserializer owns the mapping
+    // the mapping is moved in last, the mapped address does not change by the move
+    Deserializer(from_json_t /* tag */, MappedFile mapped_file, MetaData const& meta_data)
+        : meta_data_{&meta_data},
+          json_reader_{JsonReader::create({mapped_file.data().data(), mapped_file.data().size()})},
+          buffer_from_json_{json_reader_.has_value()
+                                ? msgpack::sbuffer{}
+                                : json_to_msgpack({mapped_file.data().data(), mapped_file.data().size()})},
+          data_{json_reader_.has_value() ? mapped_file.data().data() : buffer_from_json_.data()},
+          size_{json_reader_.has_value() ? mapped_file.data().size() : buffer_from_json_.size()},
+          dataset_handler_{pre_parse()},
+          mapped_file_{std::move(mapped_file)} {}
 
     static msgpack::sbuffer json_to_msgpack(std::string_view json_string) {
         JsonSAXVisitor visitor{};
@@ -495,11 +1114,24 @@ class Deserializer {
         return msgpack_data;
     }
 
+    // parse a single value from the msgpack data or the json, moving the offset forward by giving a reference
+    template <class Visitor> void parse_value(size_t& offset, Visitor& visitor) {
+        if (json_reader_.has_value()) {
+            json_reader_->parse(offset, visitor);
+        } else {
+            msgpack::parse(data_, size_, offset, visitor);
+        }
+    }
+
     template <class map_array, bool move_forward> MapArrayVisitor<map_array> parse_map_array() {
         MapArrayVisitor<map_array> visitor{};
         if constexpr (move_forward) {
             // move offset forward by giving a reference
-            msgpack::parse(data_, size_, offset_, visitor);
+            parse_value(offset_, visitor);
+        } else if (json_reader_.has_value()) {
+            // parse but without changing offset
+            size_t offset = offset_;
+            json_reader_->parse(offset, visitor);
         } else {
             // parse but without changing offset
             msgpack::parse(data_ + offset_, size_ - offset_, visitor);
@@ -509,25 +1141,34 @@ class Deserializer {
 
     std::string_view parse_string() {
         StringVisitor visitor{};
-        msgpack::parse(data_, size_, offset_, visitor);
+        parse_value(offset_, visitor);
         return visitor.str;
     }
 
     bool parse_bool() {
         BoolVisitor visitor{};
-        msgpack::parse(data_, size_, offset_, visitor);
+        parse_value(offset_, visitor);
         return visitor.value;
     }
 
+    // the skipped values are not visited, the json is skipped through its index of containers
+    // and the msgpack through its size headers
     void parse_skip() {
-        DefaultNullVisitor visitor{};
-        msgpack::parse(data_, size_, offset_, visitor);
+        if (json_reader_.has_value()) {
+            DefaultNullVisitor visitor{};
+            json_reader_->parse(offset_, visitor);
+        } else {
+            detail::skip_msgpack_value(data_, size_, offset_);
+        }
     }
 
     bool parse_skip_check_map() {
-        CheckHasMap visitor{};
-        msgpack::parse(data_, size_, offset_, visitor);
-        return visitor.has_map;
+        if (json_reader_.has_value()) {
+            CheckHasMap visitor{};
+            json_reader_->parse(offset_, visitor);
+            return visitor.has_map;
+        }
+        return detail::skip_msgpack_value(data_, size_, offset_);
     }
 
     WritableDataset pre_parse() {
@@ -606,6 +1247,31 @@ class Deserializer {
         return handler;
     }
 
+    // the number of elements per scenario and the attributes are read from the tables
+    WritableDataset pre_parse_columnar() {
+        auto const& reader = *columnar_reader_;
+        is_batch_ = reader.is_batch();
+        total_batch_size_ = reader.batch_size();
+        WritableDataset handler{is_batch_, total_batch_size_, reader.dataset().name, *meta_data_};
+        for (auto const& component : reader.components()) {
+            std::string_view const component_name = component.component->name;
+            IdxVector const counter = reader.elements_per_scenario(component);
+            std::vector<ComponentByteMeta> component_byte_meta(counter.size());
+            std::ranges::transform(counter, component_byte_meta.begin(), [component_name](Idx size) {
+                return ComponentByteMeta{.component = component_name, .size = size, .offset = 0, .has_map = false};
+            });
+            msg_data_offsets_.push_back(std::move(component_byte_meta));
+            add_component_info(handler, component_name, counter);
+
+            auto& attributes = attributes_[component.component];
+            std::ranges::transform(component.attributes, std::back_inserter(attributes),
+                                   [](auto const& x) { return x.attribute; });
+            handler.enable_attribute_indications(component_name);
+            handler.set_attribute_indications(component_name, attributes);
+        }
+        return handler;
+    }
+
     AttributeByteMeta read_predefined_attributes() {
         AttributeByteMeta attributes;
         Idx n_components = parse_map_array<visit_map_t, move_forward>().size;
@@ -663,6 +1329,7 @@ class Deserializer {
             data_counts.push_back(pre_count_scenario());
         }
         scenario_number_ = -1;
+        total_batch_size_ = batch_size;
         return data_counts;
     }
 
@@ -719,11 +1386,7 @@ class Deserializer {
         }
         scenario_number_ = -1;
 
-        Idx const elements_per_scenario = get_uniform_elements_per_scenario(counter);
-        Idx const total_elements = // total element based on is_uniform
-            elements_per_scenario < 0 ? std::reduce(counter.cbegin(), counter.cend()) : // aggregation
-                elements_per_scenario * batch_size;                                     // multiply
-        handler.add_component_info(component_key_, elements_per_scenario, total_elements);
+        add_component_info(handler, component_key_, counter);
         // check if all scenarios only contain array data
         bool const only_values_in_data =
             std::ranges::none_of(component_byte_meta, [](auto const& x) { return x.has_map; });
@@ -735,68 +1398,162 @@ class Deserializer {
         component_key_ = {};
     }
 
-    bool check_uniform(IdxVector const& counter) {
-        if (dataset_handler_.batch_size() < 2) {
+    std::span<ComponentByteMeta const> selected_msg_data(Idx component_idx, Idx first_scenario,
+                                                         Idx n_scenarios) const {
+        return std::span{msg_data_offsets_[component_idx]}.subspan(narrow_cast<size_t>(first_scenario),
+                                                                   narrow_cast<size_t>(n_scenarios));
+    }
+
+    // add the component with the number of elements per scenario
+    static void add_component_info(WritableDataset& handler, std::string_view component, IdxVector const& counter) {
+        Idx const elements_per_scenario = get_uniform_elements_per_scenario(counter);
+        Idx const total_elements = // total element based on is_uniform
+            elements_per_scenario < 0 ? std::reduce(counter.cbegin(), counter.cend()) : // aggregation
+                elements_per_scenario * static_cast<Idx>(counter.size());               // multiply
+        handler.add_component_info(component, elements_per_scenario, total_elements);
+    }
+
+    static bool check_uniform(IdxVector const& counter) {
+        if (counter.size() < 2) {
             return true;
         }
         return std::transform_reduce(counter.cbegin(), counter.cend() - 1, counter.cbegin() + 1, true,
                                      std::logical_and{}, std::equal_to{});
     }
 
-    Idx get_uniform_elements_per_scenario(IdxVector const& counter) {
+    static Idx get_uniform_elements_per_scenario(IdxVector const& counter) {
         if (!check_uniform(counter)) {
             return -1;
         }
-        if (dataset_handler_.batch_size() == 0) {
+        if (counter.empty()) {
             return 0;
         }
         return counter.front();
     }
 
-    void parse_component(Idx component_idx) {
-        if (dataset_handler_.is_row_based(component_idx)) {
-            parse_component(row_based, component_idx);
-        } else if (dataset_handler_.is_columnar(component_idx, true)) {
-            parse_component(columnar, component_idx);
+    Idx get_n_threads() const {
+        if (threading_ < 0 || threading_ == 1) {
+            return 1;
         }
+        auto const n_threads = threading_ == 0 ? static_cast<Idx>(std::thread::hardware_concurrency()) : threading_;
+        return std::max(Idx{1}, std::min(n_threads, dataset_handler_.batch_size()));
     }
 
-    template <detail::row_based_or_columnar_c row_or_column_t>
-    void parse_component(row_or_column_t row_or_column_tag, Idx component_idx) {
-        auto const& buffer = dataset_handler_.get_buffer(component_idx);
+    // parse the scenarios in contiguous blocks on multiple threads, each with its own copy of the parsing state
+    // the scenarios of a block are written to their own part of the buffers
+    // the first exception, in the order of the blocks, is rethrown after all threads have finished
+    void parse_parallel(Idx n_threads) {
+        Idx const batch_size = dataset_handler_.batch_size();
+        std::vector<std::exception_ptr> exceptions(n_threads);
+        std::vector<std::thread> threads;
+        threads.reserve(n_threads);
+        for (Idx thread_number = 0; thread_number != n_threads; ++thread_number) {
+            threads.emplace_back([this, &exceptions, thread_number, n_threads, batch_size] {
+                try {
+                    Deserializer worker{parallel_worker, *this};
+                    worker.parse_scenarios(batch_size * thread_number / n_threads,
+                                           batch_size * (thread_number + 1) / n_threads);
+                } catch (...) {
+                    exceptions[thread_number] = std::current_exception();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
 
-        assert(dataset_handler_.is_row_based(buffer) == detail::is_row_based_v<row_or_column_t>);
-        assert(dataset_handler_.is_columnar(buffer, true) == detail::is_columnar_v<row_or_column_t>);
-        assert(is_row_based(buffer) == detail::is_row_based_v<row_or_column_t>);
-        assert(is_columnar(buffer) == detail::is_columnar_v<row_or_column_t>);
+    // copy the arrays of the selected scenarios as a whole, there is nothing to parse
+    void parse_columnar() const {
+        auto const components = columnar_reader_->components();
+        for (Idx i = 0; i != dataset_handler_.n_components(); ++i) {
+            auto const& component = components[i];
+            columnar_format::Reader::copy_to(component,
+                                             columnar_format::Reader::element_offset(component, first_scenario_),
+                                             dataset_handler_.get_component_info(i).total_elements,
+                                             dataset_handler_.get_buffer(i));
+        }
+    }
 
-        auto const& info = dataset_handler_.get_component_info(component_idx);
-        auto const& msg_data = msg_data_offsets_[component_idx];
+    // parse the scenarios in [begin, end) of all components, the components should be prepared
+    void parse_scenarios(Idx scenario_begin, Idx scenario_end) {
+        root_key_ = "data";
+        try {
+            for (Idx i = 0; i != dataset_handler_.n_components(); ++i) {
+                parse_component(i, scenario_begin, scenario_end);
+            }
+        } catch (std::exception& e) {
+            handle_error(e);
+        }
+        root_key_ = {};
+    }
 
-        Idx const batch_size = dataset_handler_.batch_size();
-        component_key_ = info.component->name;
+    // set nan and the indptr of the whole component
+    void prepare_component(Idx component_idx) {
+        auto const& buffer = dataset_handler_.get_buffer(component_idx);
+        auto const& info = dataset_handler_.get_component_info(component_idx);
 
         // set nan
-        set_nan(row_or_column_tag, buffer, info);
+        if (dataset_handler_.is_row_based(component_idx)) {
+            set_nan(row_based, buffer, info);
+        } else if (dataset_handler_.is_columnar(component_idx, true)) {
+            set_nan(columnar, buffer, info);
+        } else {
+            return;
+        }
 
         // handle indptr
         if (info.elements_per_scenario < 0) {
+            auto const msg_data = selected_msg_data(component_idx, first_scenario_, dataset_handler_.batch_size());
             // first always zero
             buffer.indptr.front() = 0;
             // accumulate sum
             std::transform_inclusive_scan(
-                msg_data.cbegin(), msg_data.cend(), buffer.indptr.begin() + 1, std::plus{},
+                msg_data.begin(), msg_data.end(), buffer.indptr.begin() + 1, std::plus{},
                 [](auto const& x) { return x.size; }, Idx{});
         }
+    }
 
-        // attributes
-        std::span<MetaAttribute const* const> const attributes = [this,
-                                                                  &info]() -> std::span<MetaAttribute const* const> {
-            if (auto const it = attributes_.find(info.component); it != attributes_.cend()) {
-                return it->second;
+    void parse_component(Idx component_idx, Idx scenario_begin, Idx scenario_end) {
+        if (dataset_handler_.is_row_based(component_idx)) {
+            // the generated kernel of the component is used when the predefined attributes are in the default order
+            MetaComponent const& component = *dataset_handler_.get_component_info(component_idx).component;
+            std::vector<bool> const selected =
+                detail::select_attributes_in_default_order(component, predefined_attributes(component));
+            RowBasedKernel kernel{};
+            kernel.selected = &selected;
+            if (!selected.empty() && meta_data_gen::visit_component_struct(component, [&kernel]<class StructType>() {
+                    kernel.parse_values = &Deserializer::parse_values_with_kernel<StructType>;
+                })) {
+                parse_component(kernel, component_idx, scenario_begin, scenario_end);
+                return;
             }
-            return {};
-        }();
+            parse_component(row_based, component_idx, scenario_begin, scenario_end);
+        } else if (dataset_handler_.is_columnar(component_idx, true)) {
+            parse_component(columnar, component_idx, scenario_begin, scenario_end);
+        }
+    }
+
+    template <detail::row_based_or_columnar_c row_or_column_t>
+    void parse_component(row_or_column_t row_or_column_tag, Idx component_idx, Idx scenario_begin,
+                         Idx scenario_end) {
+        auto const& buffer = dataset_handler_.get_buffer(component_idx);
+
+        assert(dataset_handler_.is_row_based(buffer) == detail::is_row_based_v<row_or_column_t>);
+        assert(dataset_handler_.is_columnar(buffer, true) == detail::is_columnar_v<row_or_column_t>);
+        assert(is_row_based(buffer) == detail::is_row_based_v<row_or_column_t>);
+        assert(is_columnar(buffer) == detail::is_columnar_v<row_or_column_t>);
+
+        auto const& info = dataset_handler_.get_component_info(component_idx);
+        auto const msg_data = selected_msg_data(component_idx, first_scenario_, dataset_handler_.batch_size());
+        component_key_ = info.component->name;
+
+        std::span<MetaAttribute const* const> const attributes = predefined_attributes(*info.component);
         auto const reordered_attribute_buffers = detail::is_columnar_v<row_or_column_t>
                                                      ? detail::reordered_attribute_buffers(buffer, attributes)
                                                      : std::vector<AttributeBuffer<void>>{};
@@ -814,27 +1571,34 @@ class Deserializer {
         BufferView const buffer_view{
             .buffer = &buffer, .idx = 0, .reordered_attribute_buffers = reordered_attribute_buffers};
 
-        // all scenarios
-        for (scenario_number_ = 0; scenario_number_ != batch_size; ++scenario_number_) {
-            Idx const scenario_offset = info.elements_per_scenario < 0 ? buffer_view.buffer->indptr[scenario_number_]
-                                                                       : scenario_number_ * info.elements_per_scenario;
+        // the error report uses the scenario number in the whole batch
+        for (Idx scenario = scenario_begin; scenario != scenario_end; ++scenario) {
+            scenario_number_ = first_scenario_ + scenario;
+            Idx const scenario_offset = info.elements_per_scenario < 0 ? buffer_view.buffer->indptr[scenario]
+                                                                       : scenario * info.elements_per_scenario;
 #ifndef NDEBUG
             if (info.elements_per_scenario < 0) {
-                assert(buffer_view.buffer->indptr[scenario_number_ + 1] -
-                           buffer_view.buffer->indptr[scenario_number_] ==
-                       msg_data[scenario_number_].size);
+                assert(buffer_view.buffer->indptr[scenario + 1] - buffer_view.buffer->indptr[scenario] ==
+                       msg_data[scenario].size);
 
             } else {
-                assert(info.elements_per_scenario == msg_data[scenario_number_].size);
+                assert(info.elements_per_scenario == msg_data[scenario].size);
             }
 #endif
-            BufferView const scenario = advance(buffer_view, scenario_offset);
-            parse_scenario(row_or_column_tag, *info.component, scenario, msg_data[scenario_number_], attributes);
+            BufferView const scenario_view = advance(buffer_view, scenario_offset);
+            parse_scenario(row_or_column_tag, *info.component, scenario_view, msg_data[scenario], attributes);
         }
         scenario_number_ = -1;
         component_key_ = "";
     }
 
+    std::span<MetaAttribute const* const> predefined_attributes(MetaComponent const& component) const {
+        if (auto const it = attributes_.find(&component); it != attributes_.cend()) {
+            return it->second;
+        }
+        return {};
+    }
+
     void parse_scenario(detail::row_based_or_columnar_c auto row_or_column_tag, MetaComponent const& component,
                         BufferView const& buffer_view, ComponentByteMeta const& msg_data,
                         std::span<MetaAttribute const* const> attributes) {
@@ -866,13 +1630,14 @@ class Deserializer {
         offset_ = 0;
     }
 
-    void parse_element(row_based_t tag, BufferView const& buffer_view, MetaComponent const& component,
+    template <std::derived_from<row_based_t> row_based_tag_t>
+    void parse_element(row_based_tag_t tag, BufferView const& buffer_view, MetaComponent const& component,
                        std::span<MetaAttribute const* const> attributes) {
         assert(is_row_based(buffer_view));
 
         auto const element_visitor = parse_map_array<visit_map_array_t, move_forward>();
         if (element_visitor.is_map) {
-            parse_map_element(tag, buffer_view, element_visitor.size, component);
+            parse_map_element(row_based, buffer_view, element_visitor.size, component);
         } else {
             parse_array_element(tag, buffer_view, element_visitor.size, component, attributes);
         }
@@ -954,6 +1719,34 @@ class Deserializer {
         attribute_number_ = -1;
     }
 
+    void parse_array_element(RowBasedKernel const& kernel, BufferView const& buffer_view, Idx array_size,
+                             MetaComponent const& /*component*/, std::span<MetaAttribute const* const> attributes) {
+        assert(is_row_based(buffer_view));
+
+        if (array_size != static_cast<Idx>(attributes.size())) {
+            throw SerializationError{
+                "An element of a list should have same length as the list of predefined attributes!\n"};
+        }
+        (this->*kernel.parse_values)(buffer_view, *kernel.selected);
+    }
+
+    // the generated kernel of the component parses the values directly into the members of the element
+    template <class StructType>
+    void parse_values_with_kernel(BufferView const& buffer_view, std::vector<bool> const& selected) {
+        auto& element = *(reinterpret_cast<StructType*>(buffer_view.buffer->data) + buffer_view.idx);
+        size_t position{};
+        attribute_number_ = 0;
+        get_attributes_list<StructType>::visit_values(element, [this, &selected, &position](auto& value) {
+            if (selected[position++]) {
+                ValueVisitor<ctype_type_t<std::remove_reference_t<decltype(value)>>> visitor{
+                    detail::ctype_value(value)};
+                parse_value(offset_, visitor);
+                ++attribute_number_;
+            }
+        });
+        attribute_number_ = -1;
+    }
+
     void parse_attribute(row_based_t /*tag*/, BufferView const& buffer_view, MetaComponent const& component,
                          MetaAttribute const& attribute) { // call relevant parser
         assert(is_row_based(buffer_view));
@@ -961,7 +1754,7 @@ class Deserializer {
         ctype_func_selector(attribute.ctype, [&buffer_view, &component, &attribute, this]<class T> {
             ValueVisitor<T> visitor{
                 attribute.get_attribute<T>(component.advance_ptr(buffer_view.buffer->data, buffer_view.idx))};
-            msgpack::parse(data_, size_, offset_, visitor);
+            parse_value(offset_, visitor);
         });
     }
 
@@ -972,7 +1765,7 @@ class Deserializer {
 
         ctype_func_selector(buffer.meta_attribute->ctype, [&buffer, &idx, this]<class T> {
             ValueVisitor<T> visitor{*(reinterpret_cast<T*>(buffer.data) + idx)};
-            msgpack::parse(data_, size_, offset_, visitor);
+            parse_value(offset_, visitor);
         });
     }
 
@@ -998,6 +1791,8 @@ class Deserializer {
             return {from_json, std::string_view{buffer.data(), buffer.size()}, meta_data};
         case SerializationFormat::msgpack:
             return {from_msgpack, buffer, meta_data};
+        case SerializationFormat::columnar:
+            return {from_columnar, buffer, meta_data};
         default: {
             using namespace std::string_literals;
             throw SerializationError("Buffer data input not supported for serialization format "s +
@@ -1006,6 +1801,17 @@ class Deserializer {
         }
     }
 
+    static Deserializer create_from_format(MappedFile mapped_file, SerializationFormat serialization_format,
+                                           MetaData const& meta_data) {
+        if (serialization_format == SerializationFormat::json) {
+            return {from_json, std::move(mapped_file), meta_data};
+        }
+        // the mapped address does not change when the mapping is moved into the deserializer
+        Deserializer deserializer = create_from_format(mapped_file.data(), serialization_format, meta_data);
+        deserializer.mapped_file_ = std::move(mapped_file);
+        return deserializer;
+    }
+
     static void set_nan(row_based_t /*tag*/, Buffer const& buffer, ComponentInfo const& info) {
         assert(is_row_based(buffer));
         info.component->set_nan(buffer.data, 0, info.total_elements);
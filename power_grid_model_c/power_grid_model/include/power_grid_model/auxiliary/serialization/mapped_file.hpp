@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "../../common/exception.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define PGM_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#define PGM_UNDEF_NOMINMAX
+#endif
+#include <windows.h>
+#ifdef PGM_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef PGM_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#ifdef PGM_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef PGM_UNDEF_NOMINMAX
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace power_grid_model::meta_data {
+
+// read-only memory mapping of a whole file
+// the pages are loaded by the operating system on demand and can be evicted again,
+//     so the file does not need to fit in memory
+class MappedFile {
+  public:
+    MappedFile() = default;
+    explicit MappedFile(std::filesystem::path const& file_path) { map(file_path); }
+
+    // not copyable
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    // movable, the mapped address does not change
+    MappedFile(MappedFile&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)} {}
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+    ~MappedFile() { unmap(); }
+
+    std::span<char const> data() const { return {data_, size_}; }
+
+  private:
+    char const* data_{nullptr};
+    size_t size_{0};
+
+    [[noreturn]] static void throw_error(std::filesystem::path const& file_path) {
+        throw SerializationError{"Cannot map file into memory: " + file_path.string() + "\n"};
+    }
+
+#ifdef _WIN32
+    void map(std::filesystem::path const& file_path) {
+        HANDLE const file = CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw_error(file_path);
+        }
+        LARGE_INTEGER file_size{};
+        if (GetFileSizeEx(file, &file_size) == 0) {
+            CloseHandle(file);
+            throw_error(file_path);
+        }
+        if (file_size.QuadPart == 0) { // an empty file cannot be mapped
+            CloseHandle(file);
+            return;
+        }
+        HANDLE const mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            throw_error(file_path);
+        }
+        // the view keeps the mapping alive
+        void const* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr) {
+            throw_error(file_path);
+        }
+        data_ = static_cast<char const*>(view);
+        size_ = static_cast<size_t>(file_size.QuadPart);
+    }
+
+    void unmap() noexcept {
+        if (data_ != nullptr) {
+            UnmapViewOfFile(data_);
+        }
+    }
+#else
+    void map(std::filesystem::path const& file_path) {
+        int const fd = open(file_path.c_str(), O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        if (fd < 0) {
+            throw_error(file_path);
+        }
+        struct stat file_stat{};
+        if (fstat(fd, &file_stat) != 0) {
+            close(fd);
+            throw_error(file_path);
+        }
+        if (file_stat.st_size == 0) { // an empty file cannot be mapped
+            close(fd);
+            return;
+        }
+        auto const file_size = static_cast<size_t>(file_stat.st_size);
+        // the mapping keeps the file alive
+        void* const view = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (view == MAP_FAILED) { // NOLINT(cppcoreguidelines-pro-type-cstyle-cast,performance-no-int-to-ptr)
+            throw_error(file_path);
+        }
+        // the data is mostly read from front to back
+        posix_madvise(view, file_size, POSIX_MADV_SEQUENTIAL);
+        data_ = static_cast<char const*>(view);
+        size_ = file_size;
+    }
+
+    void unmap() noexcept {
+        if (data_ != nullptr) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            munmap(const_cast<char*>(data_), size_);
+        }
+    }
+#endif
+};
+
+} // namespace power_grid_model::meta_data
@@ -4,21 +4,26 @@
 
 #pragma once
 
+#include "columnar_format.hpp"
 #include "common.hpp"
 
 #include "../../common/common.hpp"
 #include "../../common/exception.hpp"
+#include "../../common/typing.hpp"
 #include "../dataset.hpp"
 #include "../meta_data.hpp"
+#include "../meta_data_gen.hpp"
 
 #include <nlohmann/json.hpp>
 
 #include <msgpack.hpp>
 
-#include <iomanip>
+#include <array>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
 #include <limits>
 #include <span>
-#include <sstream>
 #include <stack>
 #include <string_view>
 
@@ -27,18 +32,6 @@ namespace msgpack { // NOLINT(modernize-concat-nested-namespaces)
 MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS) {
     namespace adaptor {
 
-    // pack name of component and attribute
-    template <class T>
-        requires(std::same_as<T, power_grid_model::meta_data::MetaComponent> ||
-                 std::same_as<T, power_grid_model::meta_data::MetaAttribute>)
-    struct pack<T const*> {
-        template <typename Stream>
-        msgpack::packer<Stream>& operator()(msgpack::packer<Stream>& p, T const* const& o) const {
-            p.pack(o->name);
-            return p;
-        }
-    };
-
     // pack double[3]
     template <> struct pack<power_grid_model::RealValue<power_grid_model::asymmetric_t>> {
         template <typename Stream>
@@ -63,146 +56,226 @@ MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS) {
 
 namespace power_grid_model::meta_data {
 
+namespace detail {
+
+// staging buffer of fixed size in front of a sink, the sink is called with the data when the buffer is full
+// it provides the stream interface of the msgpack packer
+// the sink is type erased, it is only called once per full buffer,
+//     and the packers and the kernels of all components are not instantiated again for each sink
+class StagingBuffer {
+  public:
+    static constexpr size_t capacity = size_t{1} << 16;
+
+    template <typename Sink>
+        requires std::invocable<Sink&, std::span<char const>>
+    explicit StagingBuffer(Sink& sink)
+        : sink_{const_cast<void*>(static_cast<void const*>(&sink))}, // NOLINT(cppcoreguidelines-pro-type-const-cast)
+          call_sink_{[](void* sink_ptr, std::span<char const> data) {
+              (*static_cast<Sink*>(sink_ptr))(data);
+          }} {
+        buffer_.reserve(capacity);
+    }
+
+    void write(char const* data, size_t size) {
+        if (size > capacity - buffer_.size()) {
+            flush();
+            if (size >= capacity) {
+                call_sink_(sink_, std::span<char const>{data, size});
+                return;
+            }
+        }
+        buffer_.insert(buffer_.end(), data, data + size);
+    }
+
+    void flush() {
+        if (!buffer_.empty()) {
+            call_sink_(sink_, std::span<char const>{buffer_});
+            buffer_.clear();
+        }
+    }
+
+  private:
+    void* sink_;
+    std::add_pointer_t<void(void*, std::span<char const>)> call_sink_;
+    std::vector<char> buffer_;
+};
+
+} // namespace detail
+
 namespace json_converter {
 
 struct MapArray {
-    MapArray(uint32_t size_input) : size{size_input}, empty{size_input == 0} {}
+    MapArray(uint32_t size_input, bool is_map_input)
+        : size{size_input}, empty{size_input == 0}, is_map{is_map_input} {}
 
     uint32_t size;
     bool empty;
+    bool is_map;
     bool begin{true};
+    bool expect_key{true}; // only for map
 };
 
-template <typename T> struct NullVisitor : msgpack::null_visitor {
+// write json to a stream, with the same packing interface as the msgpack packer
+// numbers are formatted with std::to_chars
+template <typename Stream> class JsonWriter {
+  public:
+    static constexpr char sep_char = ' ';
+
+    JsonWriter(Stream& stream, Idx indent, Idx max_indent_level)
+        : stream_{&stream}, indent_{indent}, max_indent_level_{max_indent_level} {}
+
+    JsonWriter& pack_nil() {
+        pack_scalar("null");
+        return *this;
+    }
+    JsonWriter& pack(bool v) {
+        using namespace std::string_view_literals;
+        pack_scalar(v ? "true"sv : "false"sv);
+        return *this;
+    }
+    template <std::integral T> JsonWriter& pack(T v) {
+        std::array<char, std::numeric_limits<T>::digits10 + 3> buffer{};
+        auto const result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), v);
+        assert(result.ec == std::errc{});
+        pack_scalar(std::string_view{buffer.data(), result.ptr});
+        return *this;
+    }
+    JsonWriter& pack(double v) {
+        if (std::isinf(v)) {
+            using namespace std::string_view_literals;
+            pack_scalar(v > 0.0 ? R"("inf")"sv : R"("-inf")"sv);
+            return *this;
+        }
+        // same as printing with the precision of digits10 + 2
+        std::array<char, 32> buffer{};
+        auto const result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), v, std::chars_format::general,
+                                          std::numeric_limits<double>::digits10 + 2);
+        assert(result.ec == std::errc{});
+        pack_scalar(std::string_view{buffer.data(), result.ptr});
+        return *this;
+    }
+    JsonWriter& pack(RealValue<asymmetric_t> const& v) {
+        pack_array(3);
+        for (int8_t i = 0; i != 3; ++i) {
+            if (is_nan(v(i))) {
+                pack_nil();
+            } else {
+                pack(v(i));
+            }
+        }
+        return *this;
+    }
+    JsonWriter& pack(char const* v) { return pack(std::string_view{v}); }
+    JsonWriter& pack(std::string_view v) {
+        start_value();
+        put('"');
+        put(v);
+        put('"');
+        end_value();
+        return *this;
+    }
+    JsonWriter& pack_array(uint32_t num_elements) {
+        start_value();
+        map_array_.emplace(num_elements, false);
+        put('[');
+        if (num_elements == 0) {
+            end_map_array();
+        }
+        return *this;
+    }
+    JsonWriter& pack_map(uint32_t num_kv_pairs) {
+        start_value();
+        map_array_.emplace(num_kv_pairs, true);
+        put('{');
+        if (num_kv_pairs == 0) {
+            end_map_array();
+        }
+        return *this;
+    }
+
   private:
-    NullVisitor() = default;
-    friend T; // CRTP compliance
-};
+    Stream* stream_;
+    Idx indent_;
+    Idx max_indent_level_;
+    std::stack<MapArray> map_array_;
 
-struct JsonConverter : NullVisitor<JsonConverter> {
-    static constexpr char sep_char = ' ';
+    void put(char c) { stream_->write(&c, 1); }
+    void put(std::string_view str) { stream_->write(str.data(), str.size()); }
 
-    Idx indent{};
-    Idx max_indent_level{};
-    std::stringstream ss{};
-    std::stack<MapArray> map_array{};
+    void pack_scalar(std::string_view str) {
+        start_value();
+        put(str);
+        end_value();
+    }
 
     void print_indent() {
-        if (indent < 0) {
+        if (indent_ < 0) {
             return;
         }
-        Idx const indent_level = static_cast<Idx>(map_array.size());
-        if (indent_level > max_indent_level) {
-            if (map_array.top().begin) {
-                map_array.top().begin = false;
+        Idx const indent_level = static_cast<Idx>(map_array_.size());
+        if (indent_level > max_indent_level_) {
+            if (map_array_.top().begin) {
+                map_array_.top().begin = false;
                 return;
             }
-            ss << sep_char;
+            put(sep_char);
             return;
         }
-        ss << '\n';
-        ss << std::string(indent_level * indent, sep_char);
+        put('\n');
+        for (Idx i = 0; i != indent_level * indent_; ++i) {
+            put(sep_char);
+        }
     }
 
     void print_key_val_sep() {
-        if (indent < 0) {
+        if (indent_ < 0) {
             return;
         }
-        ss << sep_char;
+        put(sep_char);
     }
 
-    bool visit_nil() {
-        ss << "null";
-        return true;
-    }
-    bool visit_boolean(bool v) {
-        if (v) {
-            ss << "true";
-        } else {
-            ss << "false";
+    // start of an array item, or of a key of a map
+    void start_value() {
+        if (map_array_.empty()) {
+            return;
         }
-        return true;
-    }
-    bool visit_positive_integer(uint64_t v) {
-        ss << v;
-        return true;
-    }
-    bool visit_negative_integer(int64_t v) {
-        ss << v;
-        return true;
-    }
-    bool visit_float32(float v) { return visit_float64(v); }
-    bool visit_float64(double v) {
-        if (std::isinf(v)) {
-            using namespace std::string_view_literals;
-            ss << '"' << (v > 0.0 ? "inf"sv : "-inf"sv) << '"';
-        } else {
-            ss << std::setprecision(std::numeric_limits<double>::digits10 + 2) << v;
+        if (MapArray const& top = map_array_.top(); !top.is_map || top.expect_key) {
+            print_indent();
         }
-        return true;
-    }
-    bool visit_str(const char* v, uint32_t size) {
-        ss << '"' << std::string_view{v, size} << '"';
-        return true;
     }
-    bool start_array(uint32_t num_elements) {
-        map_array.emplace(num_elements);
-        ss << '[';
-        return true;
-    }
-    bool start_array_item() {
-        print_indent();
-        return true;
-    }
-    bool end_array_item() {
-        --map_array.top().size;
-        if (map_array.top().size > 0) {
-            ss << ',';
+
+    // end of an array item, or of a key or a value of a map
+    // the map or array is finished after the last value
+    void end_value() {
+        if (map_array_.empty()) {
+            return;
         }
-        return true;
-    }
-    bool end_array() {
-        bool const empty = map_array.top().empty;
-        map_array.pop();
-        if (static_cast<Idx>(map_array.size()) < max_indent_level && !empty) {
-            print_indent();
+        MapArray& top = map_array_.top();
+        if (top.is_map && top.expect_key) {
+            top.expect_key = false;
+            put(':');
+            print_key_val_sep();
+            return;
         }
-        ss << ']';
-        return true;
-    }
-    bool start_map(uint32_t num_kv_pairs) {
-        map_array.emplace(num_kv_pairs);
-        ss << '{';
-        return true;
-    }
-    bool start_map_key() {
-        print_indent();
-        return true;
-    }
-    bool end_map_key() {
-        ss << ':';
-        print_key_val_sep();
-        return true;
-    }
-    bool end_map_value() {
-        --map_array.top().size;
-        if (map_array.top().size > 0) {
-            ss << ',';
+        top.expect_key = true;
+        --top.size;
+        if (top.size > 0) {
+            put(',');
+            return;
         }
-        return true;
+        end_map_array();
     }
-    bool end_map() {
-        bool const empty = map_array.top().empty;
-        map_array.pop();
-        if (static_cast<Idx>(map_array.size()) < max_indent_level && !empty) {
+
+    void end_map_array() {
+        bool const empty = map_array_.top().empty;
+        bool const is_map = map_array_.top().is_map;
+        map_array_.pop();
+        if (static_cast<Idx>(map_array_.size()) < max_indent_level_ && !empty) {
             print_indent();
         }
-        ss << '}';
-        return true;
+        put(is_map ? '}' : ']');
+        end_value();
     }
-
-    JsonConverter(Idx indent_, Idx max_indent_level_)
-        : NullVisitor<JsonConverter>{}, indent{indent_}, max_indent_level{max_indent_level_} {}
 };
 
 } // namespace json_converter
@@ -253,6 +326,8 @@ class Serializer {
         case SerializationFormat::json:
             [[fallthrough]];
         case SerializationFormat::msgpack:
+            [[fallthrough]];
+        case SerializationFormat::columnar:
             break;
         default: {
             using namespace std::string_literals;
@@ -270,6 +345,8 @@ class Serializer {
             return get_json(use_compact_list, -1);
         case SerializationFormat::msgpack:
             return get_msgpack(use_compact_list);
+        case SerializationFormat::columnar:
+            return get_columnar();
         default: {
             using namespace std::string_literals;
             throw SerializationError("Serialization format "s +
@@ -279,6 +356,52 @@ class Serializer {
         }
     }
 
+    // write the serialized data to the sink in pieces of bounded size, the indent is only used for json
+    // the sink is called with a std::span<char const>, which is only valid during the call
+    template <typename Sink>
+        requires std::invocable<Sink&, std::span<char const>>
+    void write(Sink& sink, bool use_compact_list, Idx indent) {
+        detail::StagingBuffer stream{sink};
+        switch (serialization_format_) {
+        case SerializationFormat::json: {
+            json_converter::JsonWriter<detail::StagingBuffer> writer{stream, indent, max_json_indent_level()};
+            serialize(writer, use_compact_list);
+            break;
+        }
+        case SerializationFormat::msgpack: {
+            msgpack::packer<detail::StagingBuffer> packer{stream};
+            serialize(packer, use_compact_list);
+            break;
+        }
+        case SerializationFormat::columnar: {
+            write_columnar(stream);
+            break;
+        }
+        default: {
+            using namespace std::string_literals;
+            throw SerializationError("Serialization format "s +
+                                     std::to_string(static_cast<IntS>(serialization_format_)) +
+                                     " does not support writing to a sink"s);
+        }
+        }
+        stream.flush();
+    }
+
+    void write_to_file(std::filesystem::path const& file_path, bool use_compact_list, Idx indent) {
+        std::ofstream file{file_path, std::ios::binary};
+        if (!file) {
+            throw SerializationError{"Cannot open file for writing: " + file_path.string() + "\n"};
+        }
+        auto sink = [&file](std::span<char const> data) {
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        };
+        write(sink, use_compact_list, indent);
+        file.close();
+        if (!file) {
+            throw SerializationError{"Cannot write to file: " + file_path.string() + "\n"};
+        }
+    }
+
     std::string const& get_string(bool use_compact_list, Idx indent) {
         switch (serialization_format_) {
         case SerializationFormat::json:
@@ -304,11 +427,16 @@ class Serializer {
     // msgpack pakcer
     msgpack::sbuffer msgpack_buffer_;
     msgpack::packer<msgpack::sbuffer> packer_;
+    bool msgpack_use_compact_list_{};
     bool use_compact_list_{};
     std::map<MetaComponent const*, std::vector<MetaAttribute const*>> attributes_;
     std::map<MetaComponent const*, std::vector<AttributeBuffer<void const>>> reordered_attribute_buffers_;
 
+    // native columnar format
+    std::vector<char> columnar_buffer_;
+
     // json
+    bool json_use_compact_list_{};
     Idx json_indent_{-1};
     std::string json_buffer_;
 
@@ -380,84 +508,156 @@ class Serializer {
     }
 
     std::span<char const> get_msgpack(bool use_compact_list) {
-        if ((msgpack_buffer_.size() == 0) || (use_compact_list_ != use_compact_list)) {
-            serialize(use_compact_list);
+        if ((msgpack_buffer_.size() == 0) || (msgpack_use_compact_list_ != use_compact_list)) {
+            msgpack_buffer_.clear();
+            serialize(packer_, use_compact_list);
+            msgpack_use_compact_list_ = use_compact_list;
         }
         return {msgpack_buffer_.data(), msgpack_buffer_.size()};
     }
 
     std::string const& get_json(bool use_compact_list, Idx indent) {
-        if (json_buffer_.empty() || (use_compact_list_ != use_compact_list) || (json_indent_ != indent)) {
-            Idx const max_indent_level = dataset_handler_.is_batch() ? 4 : 3;
-            json_converter::JsonConverter visitor{indent, max_indent_level};
-            auto const msgpack_data = get_msgpack(use_compact_list);
-            msgpack::parse(msgpack_data.data(), msgpack_data.size(), visitor);
-            json_buffer_ = visitor.ss.str();
+        if (json_buffer_.empty() || (json_use_compact_list_ != use_compact_list) || (json_indent_ != indent)) {
+            json_buffer_.clear();
+            auto sink = [this](std::span<char const> data) { json_buffer_.append(data.data(), data.size()); };
+            write(sink, use_compact_list, indent);
+            json_use_compact_list_ = use_compact_list;
+            json_indent_ = indent;
         }
         return json_buffer_;
     }
 
-    void serialize(bool use_compact_list) {
-        msgpack_buffer_.clear();
+    std::span<char const> get_columnar() {
+        if (columnar_buffer_.empty()) {
+            auto sink = [this](std::span<char const> data) {
+                columnar_buffer_.insert(columnar_buffer_.end(), data.begin(), data.end());
+            };
+            write(sink, true, -1);
+        }
+        return columnar_buffer_;
+    }
+
+    // write the attributes which are not all nan as whole arrays
+    // the arrays of a columnar buffer are written as they are, those of a row based buffer are gathered
+    template <class Stream> void write_columnar(Stream& stream) {
+        check_attributes();
+        std::vector<columnar_format::ComponentEntry> entries;
+        for (auto const& component_buffer : component_buffers_) {
+            ComponentInfo const& info = dataset_handler_.get_component_info(component_buffer.component->name);
+            columnar_format::ComponentEntry entry{.component = component_buffer.component,
+                                                  .elements_per_scenario = info.elements_per_scenario,
+                                                  .total_elements = info.total_elements,
+                                                  .attributes = {}};
+            for (auto const* const attribute : attributes_.at(component_buffer.component)) {
+                entry.attributes.push_back({.attribute = attribute});
+            }
+            entries.push_back(std::move(entry));
+        }
+        auto const layout =
+            columnar_format::compute_layout(dataset_handler_.dataset(), dataset_handler_.batch_size(), entries);
+
+        columnar_format::Writer writer{stream};
+        writer.write_header(dataset_handler_.dataset(), dataset_handler_.is_batch(), dataset_handler_.batch_size(),
+                            entries, layout);
+        for (size_t i = 0; i != entries.size(); ++i) {
+            auto const& entry = entries[i];
+            auto const& component_buffer = component_buffers_[i];
+            ConstDataset::Buffer const& buffer = *component_buffer.buffer_view.buffer;
+            if (entry.elements_per_scenario < 0) {
+                writer.pad_to(entry.indptr_offset);
+                writer.write(reinterpret_cast<char const*>(buffer.indptr.data()), buffer.indptr.size_bytes());
+            }
+            auto const& reordered_attribute_buffers = reordered_attribute_buffers_.at(component_buffer.component);
+            for (size_t j = 0; j != entry.attributes.size(); ++j) {
+                MetaAttribute const& attribute = *entry.attributes[j].attribute;
+                writer.pad_to(entry.attributes[j].data_offset);
+                if (is_columnar(buffer)) {
+                    writer.write(reinterpret_cast<char const*>(reordered_attribute_buffers[j].data),
+                                 static_cast<size_t>(component_buffer.size) * attribute.size);
+                    continue;
+                }
+                ctype_func_selector(attribute.ctype, [&writer, &component_buffer, &buffer, &attribute]<class T> {
+                    for (Idx element = 0; element != component_buffer.size; ++element) {
+                        T const& value = attribute.get_attribute<T const>(
+                            component_buffer.component->advance_ptr(buffer.data, element));
+                        writer.write(reinterpret_cast<char const*>(&value), sizeof(T));
+                    }
+                });
+            }
+        }
+        writer.pad_to(layout.total_size);
+    }
+
+    Idx max_json_indent_level() const { return dataset_handler_.is_batch() ? 4 : 3; }
+
+    // pack with the msgpack packer or the json writer
+    template <class Packer> void serialize(Packer& packer, bool use_compact_list) {
         use_compact_list_ = use_compact_list;
         if (use_compact_list_) {
             check_attributes();
         } else {
             attributes_ = {};
         }
-        pack_root_dict();
-        pack_attributes();
-        pack_data();
+        pack_root_dict(packer);
+        pack_attributes(packer);
+        pack_data(packer);
     }
 
-    void pack_root_dict() {
-        pack_map(size_top_dict);
+    template <class Packer> void pack_root_dict(Packer& packer) {
+        pack_map(packer, size_top_dict);
 
-        packer_.pack("version");
-        packer_.pack(version);
+        packer.pack("version");
+        packer.pack(version);
 
-        packer_.pack("type");
-        packer_.pack(dataset_handler_.dataset().name);
+        packer.pack("type");
+        packer.pack(dataset_handler_.dataset().name);
 
-        packer_.pack("is_batch");
-        packer_.pack(dataset_handler_.is_batch());
+        packer.pack("is_batch");
+        packer.pack(dataset_handler_.is_batch());
     }
 
-    void pack_attributes() {
-        packer_.pack("attributes");
-        packer_.pack(attributes_);
+    template <class Packer> void pack_attributes(Packer& packer) {
+        packer.pack("attributes");
+        pack_map(packer, attributes_.size());
+        for (auto const& [component, attributes] : attributes_) {
+            packer.pack(component->name);
+            pack_array(packer, attributes.size());
+            for (auto const* const attribute : attributes) {
+                packer.pack(attribute->name);
+            }
+        }
     }
 
-    void pack_data() {
-        packer_.pack("data");
+    template <class Packer> void pack_data(Packer& packer) {
+        packer.pack("data");
         // as an array for batch
         if (dataset_handler_.is_batch()) {
-            pack_array(dataset_handler_.batch_size());
+            pack_array(packer, dataset_handler_.batch_size());
         }
         // pack scenarios
         for (auto const& scenario_buffer : scenario_buffers_) {
-            pack_scenario(scenario_buffer);
+            pack_scenario(packer, scenario_buffer);
         }
     }
 
-    void pack_scenario(ScenarioBuffer const& scenario_buffer) {
-        pack_map(scenario_buffer.component_buffers.size());
+    template <class Packer> void pack_scenario(Packer& packer, ScenarioBuffer const& scenario_buffer) {
+        pack_map(packer, scenario_buffer.component_buffers.size());
         for (auto const& component_buffer : scenario_buffer.component_buffers) {
-            pack_component(component_buffer);
+            pack_component(packer, component_buffer);
         }
     }
 
-    void pack_component(ComponentBuffer const& component_buffer) {
+    template <class Packer> void pack_component(Packer& packer, ComponentBuffer const& component_buffer) {
         assert(component_buffer.buffer_view.buffer != nullptr);
         if (dataset_handler_.is_row_based(*component_buffer.buffer_view.buffer)) {
-            pack_component(row_based, component_buffer);
+            pack_component(packer, row_based, component_buffer);
         } else {
-            pack_component(columnar, component_buffer);
+            pack_component(packer, columnar, component_buffer);
         }
     }
 
-    template <detail::row_based_or_columnar_c row_or_column_t>
-    void pack_component(row_or_column_t row_or_column_tag, ComponentBuffer const& component_buffer) {
+    template <class Packer, detail::row_based_or_columnar_c row_or_column_t>
+    void pack_component(Packer& packer, row_or_column_t row_or_column_tag, ComponentBuffer const& component_buffer) {
         assert(component_buffer.buffer_view.buffer != nullptr);
         assert(is_row_based(component_buffer) == detail::is_row_based_v<row_or_column_t>);
         assert(is_columnar(component_buffer) == detail::is_columnar_v<row_or_column_t>);
@@ -466,8 +666,8 @@ class Serializer {
         assert(dataset_handler_.is_columnar(*component_buffer.buffer_view.buffer) ==
                detail::is_columnar_v<row_or_column_t>);
 
-        packer_.pack(component_buffer.component);
-        pack_array(component_buffer.size);
+        packer.pack(component_buffer.component->name);
+        pack_array(packer, component_buffer.size);
         bool const use_compact_list = use_compact_list_;
         auto const attributes = [&]() -> std::span<MetaAttribute const* const> {
             if (!use_compact_list) {
@@ -486,6 +686,12 @@ class Serializer {
             return found->second;
         }();
 
+        if constexpr (detail::is_row_based_v<row_or_column_t>) {
+            if (pack_elements_with_kernel(packer, component_buffer, attributes)) {
+                return;
+            }
+        }
+
         BufferView const buffer_view{.buffer = component_buffer.buffer_view.buffer,
                                      .idx = component_buffer.buffer_view.idx,
                                      .reordered_attribute_buffers = reordered_attribute_buffers};
@@ -493,44 +699,114 @@ class Serializer {
         for (Idx element = 0; element != component_buffer.size; ++element) {
             BufferView const element_buffer = advance(buffer_view, element);
             if (use_compact_list) {
-                pack_element_in_list(row_or_column_tag, element_buffer, *component_buffer.component, attributes);
+                pack_element_in_list(packer, row_or_column_tag, element_buffer, *component_buffer.component,
+                                     attributes);
             } else {
-                pack_element_in_dict(row_or_column_tag, element_buffer, component_buffer);
+                pack_element_in_dict(packer, row_or_column_tag, element_buffer, component_buffer);
+            }
+        }
+    }
+
+    // pack the elements of a row based buffer through the generated kernel of the component
+    // returns false if the component has no kernel, the generic path is used then
+    template <class Packer>
+    bool pack_elements_with_kernel(Packer& packer, ComponentBuffer const& component_buffer,
+                                   std::span<MetaAttribute const* const> attributes) const {
+        assert(is_row_based(component_buffer));
+
+        MetaComponent const& component = *component_buffer.component;
+        std::vector<bool> const selected = detail::select_attributes_in_default_order(component, attributes);
+        if (selected.empty()) {
+            return false;
+        }
+        bool const use_compact_list = use_compact_list_;
+        return meta_data_gen::visit_component_struct(component, [&]<class StructType>() {
+            std::span const elements{reinterpret_cast<StructType const*>(component_buffer.buffer_view.buffer->data) +
+                                         component_buffer.buffer_view.idx,
+                                     narrow_cast<size_t>(component_buffer.size)};
+            for (StructType const& element : elements) {
+                if (use_compact_list) {
+                    pack_element_in_list(packer, element, selected, attributes.size());
+                } else {
+                    pack_element_in_dict(packer, element, component);
+                }
+            }
+        });
+    }
+
+    template <class Packer, class StructType>
+    static void pack_element_in_list(Packer& packer, StructType const& element, std::vector<bool> const& selected,
+                                     size_t n_selected) {
+        pack_array(packer, n_selected);
+        size_t position{};
+        get_attributes_list<StructType>::visit_values(element, [&packer, &selected, &position](auto const& value) {
+            if (selected[position++]) {
+                pack_value(packer, value);
+            }
+        });
+    }
+
+    template <class Packer, class StructType>
+    static void pack_element_in_dict(Packer& packer, StructType const& element, MetaComponent const& component) {
+        uint32_t valid_attributes_count = 0;
+        get_attributes_list<StructType>::visit_values(element, [&valid_attributes_count](auto const& value) {
+            valid_attributes_count += static_cast<uint32_t>(!is_nan(detail::ctype_value(value)));
+        });
+        pack_map(packer, valid_attributes_count);
+        size_t position{};
+        get_attributes_list<StructType>::visit_values(element, [&packer, &component, &position](auto const& value) {
+            if (!is_nan(detail::ctype_value(value))) {
+                packer.pack(component.attributes[position].name);
+                packer.pack(detail::ctype_value(value));
             }
+            ++position;
+        });
+    }
+
+    template <class Packer, class T> static void pack_value(Packer& packer, T const& value) {
+        if (is_nan(detail::ctype_value(value))) {
+            packer.pack_nil();
+        } else {
+            packer.pack(detail::ctype_value(value));
         }
     }
 
-    void pack_element_in_list(row_based_t tag, BufferView const& element_buffer, MetaComponent const& component,
-                              std::span<MetaAttribute const* const> attributes) {
+    template <class Packer>
+    static void pack_element_in_list(Packer& packer, row_based_t tag, BufferView const& element_buffer,
+                                     MetaComponent const& component,
+                                     std::span<MetaAttribute const* const> attributes) {
         assert(is_row_based(element_buffer));
 
-        pack_array(attributes.size());
+        pack_array(packer, attributes.size());
         for (auto const* const attribute : attributes) {
             if (check_nan(tag, element_buffer, component, *attribute)) {
-                packer_.pack_nil();
+                packer.pack_nil();
             } else {
-                pack_attribute(tag, element_buffer, component, *attribute);
+                pack_attribute(packer, tag, element_buffer, component, *attribute);
             }
         }
     }
 
-    void pack_element_in_list(columnar_t /*tag*/, BufferView const& element_buffer, MetaComponent const& /*component*/,
-                              [[maybe_unused]] std::span<MetaAttribute const* const> attributes) {
+    template <class Packer>
+    static void pack_element_in_list(Packer& packer, columnar_t /*tag*/, BufferView const& element_buffer,
+                                     MetaComponent const& /*component*/,
+                                     [[maybe_unused]] std::span<MetaAttribute const* const> attributes) {
         assert(is_columnar(element_buffer));
         assert(element_buffer.reordered_attribute_buffers.size() == attributes.size());
 
-        pack_array(element_buffer.reordered_attribute_buffers.size());
+        pack_array(packer, element_buffer.reordered_attribute_buffers.size());
         for (auto const& attribute_buffer : element_buffer.reordered_attribute_buffers) {
             if (check_nan(attribute_buffer, element_buffer.idx)) {
-                packer_.pack_nil();
+                packer.pack_nil();
             } else {
-                pack_attribute(attribute_buffer, element_buffer.idx);
+                pack_attribute(packer, attribute_buffer, element_buffer.idx);
             }
         }
     }
 
-    void pack_element_in_dict(row_based_t tag, BufferView const& element_buffer,
-                              ComponentBuffer const& component_buffer) {
+    template <class Packer>
+    static void pack_element_in_dict(Packer& packer, row_based_t tag, BufferView const& element_buffer,
+                                     ComponentBuffer const& component_buffer) {
         assert(is_row_based(element_buffer));
 
         uint32_t valid_attributes_count = 0;
@@ -538,17 +814,18 @@ class Serializer {
             valid_attributes_count +=
                 static_cast<uint32_t>(!check_nan(tag, element_buffer, *component_buffer.component, attribute));
         }
-        pack_map(valid_attributes_count);
+        pack_map(packer, valid_attributes_count);
         for (auto const& attribute : component_buffer.component->attributes) {
             if (!check_nan(tag, element_buffer, *component_buffer.component, attribute)) {
-                packer_.pack(attribute.name);
-                pack_attribute(tag, element_buffer, *component_buffer.component, attribute);
+                packer.pack(attribute.name);
+                pack_attribute(packer, tag, element_buffer, *component_buffer.component, attribute);
             }
         }
     }
 
-    void pack_element_in_dict(columnar_t /*tag*/, BufferView const& element_buffer,
-                              ComponentBuffer const& /*component_buffer*/) {
+    template <class Packer>
+    static void pack_element_in_dict(Packer& packer, columnar_t /*tag*/, BufferView const& element_buffer,
+                                     ComponentBuffer const& /*component_buffer*/) {
         assert(is_columnar(element_buffer));
         assert(element_buffer.reordered_attribute_buffers.empty());
 
@@ -556,31 +833,31 @@ class Serializer {
         for (auto const& attribute_buffer : element_buffer.buffer->attributes) {
             valid_attributes_count += static_cast<uint32_t>(!check_nan(attribute_buffer, element_buffer.idx));
         }
-        pack_map(valid_attributes_count);
+        pack_map(packer, valid_attributes_count);
         for (auto const& attribute_buffer : element_buffer.buffer->attributes) {
             if (!check_nan(attribute_buffer, element_buffer.idx)) {
-                packer_.pack(attribute_buffer.meta_attribute->name);
-                pack_attribute(attribute_buffer, element_buffer.idx);
+                packer.pack(attribute_buffer.meta_attribute->name);
+                pack_attribute(packer, attribute_buffer, element_buffer.idx);
             }
         }
     }
 
-    void pack_array(std::integral auto count) {
+    template <class Packer> static void pack_array(Packer& packer, std::integral auto count) {
         if (!std::in_range<uint32_t>(count)) {
             using namespace std::string_literals;
 
             throw SerializationError{"Too many objects to pack in array ("s + std::to_string(count) + ")"s};
         }
-        packer_.pack_array(static_cast<uint32_t>(count));
+        packer.pack_array(static_cast<uint32_t>(count));
     }
 
-    void pack_map(std::integral auto count) {
+    template <class Packer> static void pack_map(Packer& packer, std::integral auto count) {
         if (!std::in_range<uint32_t>(count)) {
             using namespace std::string_literals;
 
             throw SerializationError{"Too many objects to pack in map ("s + std::to_string(count) + ")"s};
         }
-        packer_.pack_map(static_cast<uint32_t>(count));
+        packer.pack_map(static_cast<uint32_t>(count));
     }
 
     static bool check_nan(row_based_t /*tag*/, BufferView const& element_buffer, MetaComponent const& component,
@@ -605,16 +882,18 @@ class Serializer {
         });
     }
 
-    void pack_attribute(row_based_t /*tag*/, BufferView const& element_buffer, MetaComponent const& component,
-                        MetaAttribute const& attribute) {
+    template <class Packer>
+    static void pack_attribute(Packer& packer, row_based_t /*tag*/, BufferView const& element_buffer,
+                               MetaComponent const& component, MetaAttribute const& attribute) {
         RawElementPtr element_ptr = component.advance_ptr(element_buffer.buffer->data, element_buffer.idx);
-        ctype_func_selector(attribute.ctype, [this, element_ptr, &attribute]<class T> {
-            packer_.pack(attribute.get_attribute<T const>(element_ptr));
+        ctype_func_selector(attribute.ctype, [&packer, element_ptr, &attribute]<class T> {
+            packer.pack(attribute.get_attribute<T const>(element_ptr));
         });
     }
-    void pack_attribute(AttributeBuffer<void const> const& attribute_buffer, Idx idx) {
-        ctype_func_selector(attribute_buffer.meta_attribute->ctype, [this, &attribute_buffer, idx]<class T> {
-            packer_.pack(*(reinterpret_cast<T const*>(attribute_buffer.data) + idx));
+    template <class Packer>
+    static void pack_attribute(Packer& packer, AttributeBuffer<void const> const& attribute_buffer, Idx idx) {
+        ctype_func_selector(attribute_buffer.meta_attribute->ctype, [&packer, &attribute_buffer, idx]<class T> {
+            packer.pack(*(reinterpret_cast<T const*>(attribute_buffer.data) + idx));
         });
     }
 
@@ -65,6 +65,18 @@ template <symmetry_tag sym_type> struct FaultShortCircuitSolverOutput {
     ComplexValue<sym> i_fault{};
 };
 
+// fault scan math output per scanned bus, for bolted faults (zero fault impedance)
+// z_thevenin is the diagonal block of the bus impedance matrix, including the source impedances
+// i_fault_single_phase(p) is the current of a single phase to ground fault in phase p, only for asymmetric
+template <symmetry_tag sym_type> struct FaultScanSolverOutput {
+    using sym = sym_type;
+
+    ComplexValue<sym> u_pre_fault{};
+    ComplexTensor<sym> z_thevenin{};
+    ComplexValue<sym> i_fault_three_phase{};
+    ComplexValue<sym> i_fault_single_phase{};
+};
+
 // appliance solver math output, always injection direction
 // s > 0, energy appliance -> node
 template <symmetry_tag sym_type> struct ApplianceSolverOutput {
@@ -187,6 +199,8 @@ struct MathModelTopology {
     Idx n_branch_to_current_sensor() const { return current_sensors_per_branch_to.element_size(); }
 
     Idx n_transformer_tap_regulator() const { return tap_regulators_per_branch.element_size(); }
+
+    friend bool operator==(MathModelTopology const& x, MathModelTopology const& y) = default;
 };
 
 struct SourceCalcParam {
@@ -200,6 +214,7 @@ struct SourceCalcParam {
             return ComplexTensor<asymmetric_t>{(2.0 * y1 + y0) / 3.0, (y0 - y1) / 3.0};
         }
     }
+    friend bool operator==(SourceCalcParam const& x, SourceCalcParam const& y) = default;
 };
 
 template <symmetry_tag sym_type> struct MathModelParam {
@@ -208,6 +223,22 @@ template <symmetry_tag sym_type> struct MathModelParam {
     std::vector<BranchCalcParam<sym>> branch_param;
     ComplexTensorVector<sym> shunt_param;
     std::vector<SourceCalcParam> source_param;
+
+    // exact comparison, to find out whether the parameters changed
+    friend bool operator==(MathModelParam const& x, MathModelParam const& y) {
+        constexpr auto tensor_equal = [](ComplexTensor<sym> const& lhs, ComplexTensor<sym> const& rhs) {
+            if constexpr (is_symmetric_v<sym>) {
+                return lhs == rhs;
+            } else {
+                return (lhs == rhs).all();
+            }
+        };
+        constexpr auto branch_equal = [tensor_equal](BranchCalcParam<sym> const& lhs, BranchCalcParam<sym> const& rhs) {
+            return std::ranges::equal(lhs.value, rhs.value, tensor_equal);
+        };
+        return std::ranges::equal(x.branch_param, y.branch_param, branch_equal) &&
+               std::ranges::equal(x.shunt_param, y.shunt_param, tensor_equal) && x.source_param == y.source_param;
+    }
 };
 
 struct MathModelParamIncrement {
@@ -247,6 +278,8 @@ struct ShortCircuitInput {
     DenseGroupedIdxVector fault_buses;
     std::vector<FaultCalcParam> faults;
     ComplexVector source; // Complex u_ref of each source
+    // also scan bolted faults at all buses, see ShortCircuitSolver::run_fault_scan
+    bool fault_scan{false};
 };
 
 template <typename T>
@@ -302,6 +335,8 @@ template <symmetry_tag sym_type> struct ShortCircuitSolverOutput {
     std::vector<BranchShortCircuitSolverOutput<sym>> branch;
     std::vector<ApplianceShortCircuitSolverOutput<sym>> source;
     std::vector<ApplianceShortCircuitSolverOutput<sym>> shunt;
+    // per bus, only for a fault scan
+    std::vector<FaultScanSolverOutput<sym>> fault_scan;
 };
 
 template <typename T>
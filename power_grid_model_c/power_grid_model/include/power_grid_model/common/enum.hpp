@@ -105,7 +105,7 @@ enum class ShortCircuitVoltageScaling : IntS { minimum = 0, maximum = 1 };
 
 enum class CType : IntS { c_int32 = 0, c_int8 = 1, c_double = 2, c_double3 = 3 };
 
-enum class SerializationFormat : IntS { json = 0, msgpack = 1 };
+enum class SerializationFormat : IntS { json = 0, msgpack = 1, columnar = 2 };
 
 enum class OptimizerType : IntS {
     no_optimization = 0,          // do nothing
@@ -124,6 +124,7 @@ enum class OptimizerStrategy : IntS { // Conventions for optimization strategies
 enum class SearchMethod : IntS { // Which type of tap search method for finite element optimization process
     linear_search = 0,           // use linear_search method: one step per iteration
     binary_search = 1,           // use binary search: half a tap range at a time
+    sensitivity_search = 2,      // use voltage-to-tap sensitivity: jump to the predicted tap position
 };
 
 enum class AngleMeasurementType : IntS { // The type of the angle measurement for current sensors
@@ -163,6 +163,8 @@ class SparseGroupedIdxVector {
     SparseGroupedIdxVector(from_dense_t /* tag */, IdxVector const& dense_group_elements, Idx num_groups)
         : SparseGroupedIdxVector{detail::sparse_encode(dense_group_elements, num_groups)} {}
 
+    friend bool operator==(SparseGroupedIdxVector const& x, SparseGroupedIdxVector const& y) = default;
+
   private:
     IdxVector indptr_;
 };
@@ -257,6 +259,8 @@ class DenseGroupedIdxVector {
     DenseGroupedIdxVector(from_dense_t /* tag */, IdxVector dense_group_elements, Idx num_groups)
         : DenseGroupedIdxVector{std::move(dense_group_elements), num_groups} {}
 
+    friend bool operator==(DenseGroupedIdxVector const& x, DenseGroupedIdxVector const& y) = default;
+
   private:
     Idx num_groups_{};
     IdxVector dense_vector_;
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// flat index from component ID to Idx2D
+
+#include "common.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace power_grid_model {
+
+// index from ID to Idx2D without per-element allocation
+//
+// during construction, the entries are stored in an open-addressing hash table with linear probing
+// when the construction is complete, the index is compacted
+//    if the IDs are dense, the entries are stored in an array directly indexed by the ID offset
+//    otherwise, the hash table is rebuilt in bulk with the minimum capacity
+// an empty slot is marked by a negative group
+class IdIndex {
+  public:
+    static constexpr Idx2D not_found{.group = -1, .pos = -1};
+
+    // reserve space for the number of entries
+    void reserve(Idx n_entries) {
+        if (!is_direct_ && 2 * n_entries > static_cast<Idx>(slots_.size())) {
+            rehash(std::max(min_capacity, static_cast<Idx>(std::bit_ceil(static_cast<uint64_t>(2 * n_entries)))));
+        }
+    }
+
+    // insert the entry, return false if the ID already exists
+    bool emplace(ID id, Idx2D idx) {
+        assert(idx.group >= 0);
+        if (is_direct_) {
+            to_hash_table();
+        }
+        if (2 * (size_ + 1) > static_cast<Idx>(slots_.size())) {
+            rehash(std::max(min_capacity, 2 * static_cast<Idx>(slots_.size())));
+        }
+        Slot& slot = slots_[find_pos(id)];
+        if (slot.idx.group >= 0) {
+            return false;
+        }
+        slot = {.id = id, .idx = idx};
+        ++size_;
+        return true;
+    }
+
+    // find the entry, return not_found if the ID does not exist
+    Idx2D find(ID id) const {
+        if (is_direct_) {
+            auto const offset = static_cast<int64_t>(id) - min_id_;
+            if (offset < 0 || offset >= static_cast<int64_t>(direct_.size())) {
+                return not_found;
+            }
+            return direct_[offset];
+        }
+        if (slots_.empty()) {
+            return not_found;
+        }
+        return slots_[find_pos(id)].idx;
+    }
+
+    bool contains(ID id) const { return find(id).group >= 0; }
+
+    Idx size() const { return size_; }
+
+    // find the ID of an entry by linear search
+    std::optional<ID> find_id(Idx2D idx) const {
+        if (is_direct_) {
+            if (auto const it = std::ranges::find(direct_, idx); it != direct_.end()) {
+                return static_cast<ID>(min_id_ + std::distance(direct_.begin(), it));
+            }
+            return std::nullopt;
+        }
+        if (auto const it = std::ranges::find(slots_, idx, &Slot::idx); it != slots_.end()) {
+            return it->id;
+        }
+        return std::nullopt;
+    }
+
+    // compact the index after the construction is complete
+    void compact() {
+        if (is_direct_ || size_ == 0) {
+            return;
+        }
+        int64_t min_id = std::numeric_limits<ID>::max();
+        int64_t max_id = std::numeric_limits<ID>::min();
+        for (Slot const& slot : slots_) {
+            if (slot.idx.group >= 0) {
+                min_id = std::min(min_id, static_cast<int64_t>(slot.id));
+                max_id = std::max(max_id, static_cast<int64_t>(slot.id));
+            }
+        }
+        auto const range = max_id - min_id + 1;
+        if (range <= dense_ratio * size_) {
+            // direct-indexed array
+            min_id_ = min_id;
+            direct_.assign(range, not_found);
+            for (Slot const& slot : slots_) {
+                if (slot.idx.group >= 0) {
+                    direct_[slot.id - min_id_] = slot.idx;
+                }
+            }
+            slots_ = {};
+            is_direct_ = true;
+        } else {
+            rehash(std::max(min_capacity, static_cast<Idx>(std::bit_ceil(static_cast<uint64_t>(2 * size_)))));
+        }
+    }
+
+  private:
+    struct Slot {
+        ID id{};
+        Idx2D idx{not_found};
+    };
+
+    static constexpr Idx min_capacity = 16;
+    // the IDs are dense if at least half of the ID range is used
+    static constexpr int64_t dense_ratio = 2;
+
+    // hash table, the capacity is a power of 2
+    std::vector<Slot> slots_;
+    // direct-indexed array, with the ID offset
+    std::vector<Idx2D> direct_;
+    int64_t min_id_{};
+    bool is_direct_{false};
+    Idx size_{};
+
+    // fibonacci hashing, the multiplication spreads consecutive IDs over the table
+    size_t home_slot(ID id) const {
+        constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+        auto const hash = static_cast<uint64_t>(static_cast<uint32_t>(id)) * multiplier;
+        return static_cast<size_t>(hash >> (64 - std::countr_zero(slots_.size())));
+    }
+
+    // find the slot of the ID, or the empty slot where it should be inserted
+    size_t find_pos(ID id) const {
+        size_t const mask = slots_.size() - 1;
+        size_t pos = home_slot(id);
+        while (slots_[pos].idx.group >= 0 && slots_[pos].id != id) {
+            pos = (pos + 1) & mask;
+        }
+        return pos;
+    }
+
+    void rehash(Idx capacity) {
+        assert(std::has_single_bit(static_cast<uint64_t>(capacity)));
+        std::vector<Slot> old_slots(capacity);
+        slots_.swap(old_slots);
+        for (Slot const& slot : old_slots) {
+            if (slot.idx.group >= 0) {
+                slots_[find_pos(slot.id)] = slot;
+            }
+        }
+    }
+
+    void to_hash_table() {
+        assert(is_direct_);
+        slots_.assign(std::max(min_capacity, static_cast<Idx>(std::bit_ceil(static_cast<uint64_t>(2 * size_ + 2)))),
+                      Slot{});
+        for (size_t offset = 0; offset != direct_.size(); ++offset) {
+            if (direct_[offset].group >= 0) {
+                auto const id = static_cast<ID>(min_id_ + static_cast<int64_t>(offset));
+                slots_[find_pos(id)] = {.id = id, .idx = direct_[offset]};
+            }
+        }
+        direct_ = {};
+        is_direct_ = false;
+    }
+};
+
+} // namespace power_grid_model
@@ -58,6 +58,25 @@ class Node final : public Base {
         ComplexValue<asymmetric_t> const uabc_pu{u_pu};
         return get_sc_output(uabc_pu);
     }
+    // including the bolted fault currents of a fault scan at this node
+    template <symmetry_tag sym>
+    NodeShortCircuitOutput get_sc_output(ComplexValue<sym> const& u_pu,
+                                         FaultScanSolverOutput<sym> const& fault_scan) const {
+        NodeShortCircuitOutput output = get_sc_output(u_pu);
+        // translate pu to A
+        double const base_i = base_power_3p / u_rated_ / sqrt3;
+        // Convert the positive sequence current to phase current, if symmetric
+        ComplexValue<asymmetric_t> const i_f_three_phase{fault_scan.i_fault_three_phase * base_i};
+        output.i_f_three_phase = cabs(i_f_three_phase);
+        output.i_f_three_phase_angle = arg(i_f_three_phase);
+        // single phase to ground faults are only scanned in an asymmetric calculation
+        if constexpr (is_asymmetric_v<sym>) {
+            ComplexValue<asymmetric_t> const i_f_single_phase{fault_scan.i_fault_single_phase * base_i};
+            output.i_f_single_phase = cabs(i_f_single_phase);
+            output.i_f_single_phase_angle = arg(i_f_single_phase);
+        }
+        return output;
+    }
     template <symmetry_tag sym> NodeOutput<sym> get_null_output() const {
         NodeOutput<sym> output{.u_pu = {}, .u = {}, .u_angle = {}, .p = {}, .q = {}};
         static_cast<BaseOutput&>(output) = base_output(false);
@@ -65,7 +84,13 @@ class Node final : public Base {
     }
 
     NodeShortCircuitOutput get_null_sc_output() const {
-        NodeShortCircuitOutput output{.u_pu = {}, .u = {}, .u_angle = {}};
+        NodeShortCircuitOutput output{.u_pu = {},
+                                      .u = {},
+                                      .u_angle = {},
+                                      .i_f_three_phase = {},
+                                      .i_f_three_phase_angle = {},
+                                      .i_f_single_phase = {},
+                                      .i_f_single_phase_angle = {}};
         static_cast<BaseOutput&>(output) = base_output(false);
         return output;
     }
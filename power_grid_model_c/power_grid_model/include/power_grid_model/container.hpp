@@ -8,6 +8,7 @@
 
 #include "common/common.hpp"
 #include "common/exception.hpp"
+#include "common/id_index.hpp"
 #include "common/iterator_facade.hpp"
 
 #include <boost/range.hpp>
@@ -17,7 +18,6 @@
 #include <memory>
 #include <numeric>
 #include <span>
-#include <unordered_map>
 
 namespace power_grid_model {
 
@@ -75,6 +75,9 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
     // reserve space
     template <supported_type_c<StorageableTypes...> Storageable> void reserve(size_t size) {
         auto& vec = std::get<std::vector<Storageable>>(vectors_);
+        if (size > vec.size()) {
+            map_.reserve(map_.size() + static_cast<Idx>(size - vec.size()));
+        }
         vec.reserve(size);
     }
 
@@ -93,7 +96,7 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
         // create object
         vec.emplace_back(std::forward<Args>(args)...);
         // insert idx to map
-        map_[id] = Idx2D{.group = group, .pos = pos};
+        map_.emplace(id, Idx2D{.group = group, .pos = pos});
     }
 
     // get item based on Idx2D
@@ -115,8 +118,8 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 #ifndef NDEBUG
     // get id by idx, only for debugging purpose
     ID get_id_by_idx(Idx2D idx_2d) const {
-        if (auto it = std::ranges::find(map_, idx_2d, &std::pair<const ID, Idx2D>::second); it != map_.end()) {
-            return it->first;
+        if (auto const id = map_.find_id(idx_2d); id.has_value()) {
+            return *id;
         }
         throw Idx2DNotFound{idx_2d};
     }
@@ -124,11 +127,11 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 
     // get idx by id
     Idx2D get_idx_by_id(ID id) const {
-        auto const found = map_.find(id);
-        if (found == map_.end()) {
+        Idx2D const found = map_.find(id);
+        if (found.group < 0) {
             throw IDNotFound{id};
         }
-        return found->second;
+        return found;
     }
     template <supported_type_c<GettableTypes...> Gettable> Idx2D get_idx_by_id(ID id) const {
         auto const result = get_idx_by_id(id);
@@ -177,9 +180,9 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
     // get sequence idx based on id
     template <supported_type_c<GettableTypes...> Gettable> Idx get_seq(ID id) const {
         assert(construction_complete_);
-        auto const found = map_.find(id);
-        assert(found != map_.end());
-        return get_seq<Gettable>(found->second);
+        Idx2D const found = map_.find(id);
+        assert(found.group >= 0);
+        return get_seq<Gettable>(found);
     }
 
     // get idx_2d based on sequence
@@ -217,11 +220,12 @@ class Container<RetrievableTypes<GettableTypes...>, StorageableTypes...> {
 #endif // !NDEBUG
         size_ = {size_per_type<GettableTypes>()...};
         cum_size_ = {accumulate_size_per_vector<GettableTypes>()...};
+        map_.compact();
     };
 
   private:
     std::tuple<std::vector<StorageableTypes>...> vectors_;
-    std::unordered_map<ID, Idx2D> map_;
+    IdIndex map_;
     std::array<Idx, num_gettable> size_;
     std::array<std::array<Idx, num_storageable + 1>, num_gettable> cum_size_;
 
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "state.hpp"
+#include "state_queries.hpp"
+
+#include "../all_components.hpp"
+
+namespace power_grid_model::main_core {
+
+namespace detail {
+
+inline void set_hot_fields(ComponentHotFields& hot_fields, Idx seq, Source const& source) {
+    hot_fields.source_status[seq] = static_cast<IntS>(source.status());
+    hot_fields.source_u_ref[seq] = source.calc_param();
+}
+
+inline void set_hot_fields(ComponentHotFields& hot_fields, Idx seq, Shunt const& shunt) {
+    hot_fields.shunt_status[seq] = static_cast<IntS>(shunt.status());
+}
+
+inline void set_hot_fields(ComponentHotFields& hot_fields, Idx seq, GenericLoadGen const& load_gen) {
+    hot_fields.load_gen_status[seq] = static_cast<IntS>(load_gen.status());
+    hot_fields.load_gen_sym_param[seq] = load_gen.template calc_param<symmetric_t>();
+    hot_fields.load_gen_asym_param[seq] = load_gen.template calc_param<asymmetric_t>();
+}
+
+template <typename Component, class ComponentContainer>
+    requires model_component_state_c<MainModelState, ComponentContainer, Component>
+inline void register_hot_fields_of(MainModelState<ComponentContainer>& state) {
+    Idx seq = 0;
+    for (Component const& component : get_component_citer<Component>(state)) {
+        set_hot_fields(state.hot_fields, seq++, component);
+    }
+}
+
+} // namespace detail
+
+// fill the hot fields of all components, the construction of the container should be complete
+template <class ComponentContainer> inline void register_hot_fields(MainModelState<ComponentContainer>& state) {
+    auto const n_source = get_component_size<Source>(state);
+    auto const n_shunt = get_component_size<Shunt>(state);
+    auto const n_load_gen = get_component_size<GenericLoadGen>(state);
+
+    ComponentHotFields& hot_fields = state.hot_fields;
+    hot_fields.source_status.resize(n_source);
+    hot_fields.source_u_ref.resize(n_source);
+    hot_fields.shunt_status.resize(n_shunt);
+    hot_fields.load_gen_status.resize(n_load_gen);
+    hot_fields.load_gen_sym_param.resize(n_load_gen);
+    hot_fields.load_gen_asym_param.resize(n_load_gen);
+
+    detail::register_hot_fields_of<Source>(state);
+    detail::register_hot_fields_of<Shunt>(state);
+    detail::register_hot_fields_of<GenericLoadGen>(state);
+}
+
+// refresh the hot fields of a single component after it is updated
+// components without hot fields are ignored
+template <typename Component, class ComponentContainer>
+    requires model_component_state_c<MainModelState, ComponentContainer, Component>
+inline void update_hot_fields(MainModelState<ComponentContainer>& state, Idx2D const& idx_2d,
+                              Component const& component) {
+    if constexpr (std::derived_from<Component, Source>) {
+        detail::set_hot_fields(state.hot_fields, get_component_sequence_idx<Source>(state, idx_2d), component);
+    } else if constexpr (std::derived_from<Component, Shunt>) {
+        detail::set_hot_fields(state.hot_fields, get_component_sequence_idx<Shunt>(state, idx_2d), component);
+    } else if constexpr (std::derived_from<Component, GenericLoadGen>) {
+        detail::set_hot_fields(state.hot_fields, get_component_sequence_idx<GenericLoadGen>(state, idx_2d), component);
+    }
+}
+
+} // namespace power_grid_model::main_core
@@ -14,6 +14,50 @@ struct MathState {
     std::vector<YBus<asymmetric_t>> y_bus_vec_asym;
     std::vector<MathSolverProxy<symmetric_t>> math_solvers_sym;
     std::vector<MathSolverProxy<asymmetric_t>> math_solvers_asym;
+
+    MathState() = default;
+    // the copied Y buses signal the copied math solvers, not those of the original
+    MathState(MathState const& other)
+        : y_bus_vec_sym{other.y_bus_vec_sym},
+          y_bus_vec_asym{other.y_bus_vec_asym},
+          math_solvers_sym{other.math_solvers_sym},
+          math_solvers_asym{other.math_solvers_asym} {
+        register_parameters_changed_callbacks();
+    }
+    MathState& operator=(MathState const& other) {
+        if (this != &other) {
+            y_bus_vec_sym = other.y_bus_vec_sym;
+            y_bus_vec_asym = other.y_bus_vec_asym;
+            math_solvers_sym = other.math_solvers_sym;
+            math_solvers_asym = other.math_solvers_asym;
+            register_parameters_changed_callbacks();
+        }
+        return *this;
+    }
+    // the math solvers do not move with their proxies, the callbacks stay valid
+    MathState(MathState&&) noexcept = default;
+    MathState& operator=(MathState&&) noexcept = default;
+    ~MathState() = default;
+
+  private:
+    void register_parameters_changed_callbacks() {
+        register_parameters_changed_callbacks(y_bus_vec_sym, math_solvers_sym);
+        register_parameters_changed_callbacks(y_bus_vec_asym, math_solvers_asym);
+    }
+
+    // the Y bus and the math solver of a math model have the same index
+    // a Y bus without a math solver yet gets its callback when the math solver is created
+    template <symmetry_tag sym>
+    static void register_parameters_changed_callbacks(std::vector<YBus<sym>>& y_bus_vec,
+                                                      std::vector<MathSolverProxy<sym>>& math_solvers) {
+        for (Idx idx = 0; idx != static_cast<Idx>(y_bus_vec.size()); ++idx) {
+            y_bus_vec[idx].clear_parameters_changed_callbacks();
+            if (idx < static_cast<Idx>(math_solvers.size())) {
+                y_bus_vec[idx].register_parameters_changed_callback(
+                    [&solver = math_solvers[idx].get()](bool changed) { solver.parameters_changed(changed); });
+            }
+        }
+    }
 };
 
 inline void clear(MathState& math_state) {
@@ -115,7 +115,11 @@ inline auto output_result(Component const& node, std::vector<SolverOutputType> c
     if (math_id.group == -1) {
         return node.get_null_sc_output();
     }
-    return node.get_sc_output(solver_output[math_id.group].u_bus[math_id.pos]);
+    auto const& math_output = solver_output[math_id.group];
+    if (!math_output.fault_scan.empty()) {
+        return node.get_sc_output(math_output.u_bus[math_id.pos], math_output.fault_scan[math_id.pos]);
+    }
+    return node.get_sc_output(math_output.u_bus[math_id.pos]);
 }
 
 // output branch
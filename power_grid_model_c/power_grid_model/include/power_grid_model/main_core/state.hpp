@@ -11,6 +11,26 @@
 
 namespace power_grid_model::main_core {
 
+// structure-of-arrays mirror of the component fields which are read for every calculation
+// the arrays are indexed by the sequence of the component within its base type (Source, Shunt, GenericLoadGen)
+// they are filled at the end of the construction and kept in sync by update_component
+struct ComponentHotFields {
+    IntSVector source_status;
+    ComplexVector source_u_ref;
+    IntSVector shunt_status;
+    IntSVector load_gen_status;
+    ComplexValueVector<symmetric_t> load_gen_sym_param;
+    ComplexValueVector<asymmetric_t> load_gen_asym_param;
+
+    template <symmetry_tag sym> ComplexValueVector<sym> const& load_gen_param() const {
+        if constexpr (is_symmetric_v<sym>) {
+            return load_gen_sym_param;
+        } else {
+            return load_gen_asym_param;
+        }
+    }
+};
+
 template <class CompContainer> struct MainModelState {
     using ComponentContainer = CompContainer;
 
@@ -23,6 +43,8 @@ template <class CompContainer> struct MainModelState {
     std::shared_ptr<TopologicalComponentToMathCoupling const> topo_comp_coup;
 
     ComponentToMathCoupling comp_coup;
+
+    ComponentHotFields hot_fields;
 };
 
 template <class StateType>
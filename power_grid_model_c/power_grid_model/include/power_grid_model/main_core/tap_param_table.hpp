@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "state.hpp"
+#include "state_queries.hpp"
+
+#include "../component/three_winding_transformer.hpp"
+#include "../component/transformer.hpp"
+#include "../component/transformer_tap_regulator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace power_grid_model::main_core {
+
+// Lookup table of the calculation parameters of a transformer for every tap position in its tap range.
+// Apart from the tap position, the parameters only depend on the connection status, which is the only other updatable
+// attribute of a transformer. The table is built for the status at construction and is not used for other statuses.
+template <typename TransformerType, symmetry_tag sym>
+    requires std::same_as<TransformerType, Transformer> || std::same_as<TransformerType, ThreeWindingTransformer>
+class TapParamTable {
+  public:
+    using ParamType = decltype(std::declval<TransformerType const&>().template calc_param<sym>());
+
+    explicit TapParamTable(TransformerType const& transformer)
+        : tap_lower_{std::min(transformer.tap_min(), transformer.tap_max())}, status_{get_status(transformer)} {
+        IntS const tap_upper = std::max(transformer.tap_min(), transformer.tap_max());
+        params_.reserve(tap_upper - tap_lower_ + 1);
+
+        auto tapped_transformer = transformer; // copy
+        for (IntS tap_pos = tap_lower_;; ++tap_pos) {
+            tapped_transformer.update(typename TransformerType::UpdateType{.id = transformer.id(), .tap_pos = tap_pos});
+            params_.push_back(tapped_transformer.template calc_param<sym>());
+            if (tap_pos == tap_upper) { // not a loop condition, to prevent overflow at the maximum tap position
+                break;
+            }
+        }
+    }
+
+    // the calculation parameters at the current tap position of the transformer, if they are in the table
+    ParamType const* find(TransformerType const& transformer) const {
+        if (get_status(transformer) != status_) {
+            return nullptr;
+        }
+        return &params_[transformer.tap_pos() - tap_lower_];
+    }
+
+  private:
+    static std::array<bool, 3> get_status(TransformerType const& transformer) {
+        if constexpr (std::same_as<TransformerType, Transformer>) {
+            return {transformer.from_status(), transformer.to_status(), false};
+        } else {
+            return {transformer.status_1(), transformer.status_2(), transformer.status_3()};
+        }
+    }
+
+    IntS tap_lower_;
+    std::array<bool, 3> status_;
+    std::vector<ParamType> params_;
+};
+
+// Tap parameter tables of all transformers that are regulated by a transformer tap regulator, by sequence index
+template <symmetry_tag sym> struct TapParamTables {
+    std::vector<std::optional<TapParamTable<Transformer, sym>>> transformer;
+    std::vector<std::optional<TapParamTable<ThreeWindingTransformer, sym>>> three_winding_transformer;
+};
+
+template <symmetry_tag sym, class ComponentContainer>
+    requires component_container_c<ComponentContainer, TransformerTapRegulator> &&
+             component_container_c<ComponentContainer, Transformer> &&
+             component_container_c<ComponentContainer, ThreeWindingTransformer>
+inline TapParamTables<sym> build_tap_param_tables(MainModelState<ComponentContainer> const& state) {
+    TapParamTables<sym> result;
+    result.transformer.resize(state.components.template size<Transformer>());
+    result.three_winding_transformer.resize(state.components.template size<ThreeWindingTransformer>());
+
+    auto const add_table = [&state]<typename TransformerType>(auto& tables, ID regulated_object) {
+        auto& table = tables[get_component_sequence_idx<TransformerType>(state, regulated_object)];
+        if (!table.has_value()) {
+            table.emplace(get_component<TransformerType>(state, regulated_object));
+        }
+    };
+
+    for (auto const& regulator : state.components.template citer<TransformerTapRegulator>()) {
+        if (regulator.regulated_object_type() == ComponentType::branch) {
+            add_table.template operator()<Transformer>(result.transformer, regulator.regulated_object());
+        } else {
+            add_table.template operator()<ThreeWindingTransformer>(result.three_winding_transformer,
+                                                                    regulator.regulated_object());
+        }
+    }
+    return result;
+}
+
+} // namespace power_grid_model::main_core
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "core_utils.hpp"
+#include "hot_fields.hpp"
 #include "state.hpp"
 
 #include "../all_components.hpp"
@@ -255,6 +256,7 @@ inline UpdateChange update_component(MainModelState<ComponentContainer>& state,
             auto& comp = get_component<Component>(state, sequence_single);
             assert(state.components.get_id_by_idx(sequence_single) == comp.id());
             auto const comp_changed = comp.update(update_data);
+            update_hot_fields<Component>(state, sequence_single, comp);
             state_changed = state_changed || comp_changed;
 
             if (comp_changed.param || comp_changed.topo) {
@@ -7,6 +7,8 @@
 #include "main_model_impl.hpp"
 
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace power_grid_model {
 
@@ -68,6 +70,10 @@ class MainModel {
 
     CalculationInfo calculation_info() const { return impl().calculation_info(); }
 
+    std::vector<char> get_topology_snapshot() { return impl().get_topology_snapshot(); }
+
+    void load_topology_snapshot(std::span<char const> data) { impl().load_topology_snapshot(data); }
+
     void check_no_experimental_features_used(Options const& options) const {
         impl().check_no_experimental_features_used(options);
     }
@@ -6,6 +6,8 @@
 
 #include "common/common.hpp"
 
+#include <optional>
+
 namespace power_grid_model {
 
 struct cached_update_t : std::true_type {};
@@ -22,12 +24,22 @@ struct MainModelOptions {
     CalculationMethod calculation_method{CalculationMethod::default_method};
     OptimizerType optimizer_type{OptimizerType::no_optimization};
     OptimizerStrategy optimizer_strategy{OptimizerStrategy::fast_any};
+    // search method of the tap position optimizer, derived from the optimizer strategy if not set
+    std::optional<SearchMethod> tap_search_method{};
 
     double err_tol{1e-8};
     Idx max_iter{20};
     Idx threading{sequential};
 
     ShortCircuitVoltageScaling short_circuit_voltage_scaling{ShortCircuitVoltageScaling::maximum};
+    // also calculate the bolted fault currents at all nodes, with one factorization
+    bool short_circuit_fault_scan{false};
+    // start each state estimation from the previous estimate, instead of a flat start
+    bool state_estimation_tracking{false};
+    // evaluate candidate tap positions of the tap position optimizer in parallel, using the threading option
+    bool speculative_tap_search{false};
+    // start the tap position search from the tap positions found in the previous scenario of the same batch thread
+    bool tap_warm_start{false};
 };
 
 } // namespace power_grid_model
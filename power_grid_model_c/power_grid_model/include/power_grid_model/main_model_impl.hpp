@@ -12,6 +12,7 @@
 #include "container.hpp"
 #include "main_model_fwd.hpp"
 #include "topology.hpp"
+#include "topology_snapshot.hpp"
 
 // common
 #include "common/common.hpp"
@@ -32,14 +33,18 @@
 // main model implementation
 #include "main_core/calculation_info.hpp"
 #include "main_core/core_utils.hpp"
+#include "main_core/hot_fields.hpp"
 #include "main_core/input.hpp"
 #include "main_core/math_state.hpp"
 #include "main_core/output.hpp"
+#include "main_core/tap_param_table.hpp"
 #include "main_core/topology.hpp"
 #include "main_core/update.hpp"
 
 // stl library
+#include <exception>
 #include <memory>
+#include <optional>
 #include <span>
 #include <thread>
 
@@ -195,9 +200,12 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     template <class CompType> void add_component(std::span<typename CompType::InputType const> components) {
         add_component<CompType>(components.begin(), components.end());
     }
+    // columnar data is copied column by column into row based structs first
     template <class CompType>
     void add_component(ConstDataset::RangeObject<typename CompType::InputType const> components) {
-        add_component<CompType>(components.begin(), components.end());
+        std::vector<typename CompType::InputType> rows(components.size());
+        components.copy_to(rows);
+        add_component<CompType>(rows);
     }
 
     // template to construct components
@@ -266,7 +274,9 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     void update_component(ConstDataset::RangeObject<typename CompType::UpdateType const> components,
                           std::span<Idx2D const> sequence_idx) {
         if (!components.empty()) {
-            update_component<CompType, CacheType>(components.begin(), components.end(), sequence_idx);
+            std::vector<typename CompType::UpdateType> rows(components.size());
+            components.copy_to(rows);
+            update_component<CompType, CacheType>(rows, sequence_idx);
         }
     }
 
@@ -320,6 +330,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
 #endif // !NDEBUG
         state_.components.set_construction_complete();
         construct_topology();
+        main_core::register_hot_fields(state_);
     }
 
     void construct_topology() {
@@ -347,6 +358,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         state_.math_topology.clear();
         state_.topo_comp_coup.reset();
         state_.comp_coup = {};
+        transformer_ranking_.reset();
     }
 
   public:
@@ -378,6 +390,9 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         // if topology changed, everything is not up to date
         // if only param changed, set param to not up to date
         is_topology_up_to_date_ = is_topology_up_to_date_ && !changes.topo;
+        if (changes.topo) {
+            transformer_ranking_.reset();
+        }
         is_sym_parameter_up_to_date_ = is_sym_parameter_up_to_date_ && !changes.topo && !changes.param;
         is_asym_parameter_up_to_date_ = is_asym_parameter_up_to_date_ && !changes.topo && !changes.param;
     }
@@ -457,27 +472,67 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         };
     }
 
-    template <symmetry_tag sym> auto calculate_state_estimation_(double err_tol, Idx max_iter) {
-        return [this, err_tol, max_iter](MainModelState const& state,
-                                         CalculationMethod calculation_method) -> std::vector<SolverOutput<sym>> {
+    // Evaluate the power flow for several candidate updates in parallel, each on its own replica of the current model.
+    // The replicas are kept and reused for the next candidates, so they should only receive cached updates.
+    // A candidate for which the calculation fails yields no result.
+    template <symmetry_tag sym>
+    auto calculate_power_flow_candidates_(std::vector<MainModelImpl>& replicas,
+                                          std::vector<ConstDataset> const& candidates, CalculationMethod method,
+                                          Options const& options) const {
+        Idx const n_candidates = narrow_cast<Idx>(candidates.size());
+        std::vector<std::optional<std::vector<SolverOutput<sym>>>> results(n_candidates);
+
+        while (narrow_cast<Idx>(replicas.size()) < n_candidates) {
+            replicas.emplace_back(*this);
+        }
+
+        auto const evaluate = [this, &replicas, &candidates, &results, method, &options](Idx start, Idx stride,
+                                                                                        Idx n_candidates_) {
+            auto& replica = replicas[start];
+            for (Idx idx = start; idx < n_candidates_; idx += stride) {
+                auto const sequence_idx = replica.get_all_sequence_idx_map(candidates[idx]);
+                try {
+                    replica.template update_components<cached_update_t>(candidates[idx], 0, sequence_idx);
+                    results[idx] = replica.template calculate_power_flow_<sym>(options.err_tol, options.max_iter)(
+                        replica.state_, method);
+                } catch (...) {
+                    results[idx] = std::nullopt;
+                }
+                try {
+                    replica.restore_components(sequence_idx);
+                } catch (...) {
+                    replica = MainModelImpl{*this};
+                }
+            }
+        };
+        batch_dispatch(evaluate, n_candidates, options.threading);
+
+        return results;
+    }
+
+    template <symmetry_tag sym> auto calculate_state_estimation_(double err_tol, Idx max_iter, bool tracking) {
+        return [this, err_tol, max_iter, tracking](MainModelState const& state, CalculationMethod calculation_method)
+                   -> std::vector<SolverOutput<sym>> {
             return calculate_<SolverOutput<sym>, MathSolverProxy<sym>, YBus<sym>, StateEstimationInput<sym>>(
                 [&state](Idx n_math_solvers) { return prepare_state_estimation_input<sym>(state, n_math_solvers); },
-                [this, err_tol, max_iter, calculation_method](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus,
-                                                              StateEstimationInput<sym> const& input) {
+                [this, err_tol, max_iter, tracking, calculation_method](
+                    MathSolverProxy<sym>& solver, YBus<sym> const& y_bus, StateEstimationInput<sym> const& input) {
+                    solver.get().set_state_estimation_tracking(tracking);
                     return solver.get().run_state_estimation(input, err_tol, max_iter, calculation_info_,
                                                              calculation_method, y_bus);
                 });
         };
     }
 
-    template <symmetry_tag sym> auto calculate_short_circuit_(ShortCircuitVoltageScaling voltage_scaling) {
-        return [this,
-                voltage_scaling](MainModelState const& /*state*/,
-                                 CalculationMethod calculation_method) -> std::vector<ShortCircuitSolverOutput<sym>> {
+    template <symmetry_tag sym>
+    auto calculate_short_circuit_(ShortCircuitVoltageScaling voltage_scaling, bool fault_scan) {
+        return [this, voltage_scaling,
+                fault_scan](MainModelState const& /*state*/,
+                            CalculationMethod calculation_method) -> std::vector<ShortCircuitSolverOutput<sym>> {
             return calculate_<ShortCircuitSolverOutput<sym>, MathSolverProxy<sym>, YBus<sym>, ShortCircuitInput>(
-                [this, voltage_scaling](Idx /* n_math_solvers */) {
+                [this, voltage_scaling, fault_scan](Idx /* n_math_solvers */) {
                     assert(is_topology_up_to_date_ && is_parameter_up_to_date<sym>());
-                    return prepare_short_circuit_input<sym>(voltage_scaling);
+                    return prepare_short_circuit_input<sym>(voltage_scaling, fault_scan);
                 },
                 [this, calculation_method](MathSolverProxy<sym>& solver, YBus<sym> const& y_bus,
                                            ShortCircuitInput const& input) {
@@ -607,12 +662,17 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     //    specified threading < 0
     //    use hardware threads, but it is either unknown (0) or only has one thread (1)
     //    specified threading = 1
+    static bool is_sequential(Idx threading) {
+        auto const hardware_thread = static_cast<Idx>(std::thread::hardware_concurrency());
+        return threading < 0 || threading == 1 || (threading == 0 && hardware_thread < 2);
+    }
+
     template <typename RunSubBatchFn>
         requires std::invocable<std::remove_cvref_t<RunSubBatchFn>, Idx /*start*/, Idx /*stride*/, Idx /*n_scenarios*/>
     static void batch_dispatch(RunSubBatchFn sub_batch, Idx n_scenarios, Idx threading) {
         // run batches sequential or parallel
         auto const hardware_thread = static_cast<Idx>(std::thread::hardware_concurrency());
-        if (threading < 0 || threading == 1 || (threading == 0 && hardware_thread < 2)) {
+        if (is_sequential(threading)) {
             // run all in sequential
             sub_batch(0, 1, n_scenarios);
         } else {
@@ -630,6 +690,31 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         }
     }
 
+    // run the setup of every math model, in parallel according to the threading of the calculation
+    // each math model only writes its own result, so the outcome does not depend on the threading
+    // the first exception, in the order of the math models, is rethrown after all threads have finished
+    template <typename SetupFn>
+        requires std::invocable<std::remove_cvref_t<SetupFn>, Idx /*math_model_idx*/>
+    void math_model_dispatch(SetupFn setup) const {
+        std::vector<std::exception_ptr> exceptions(n_math_solvers_);
+        batch_dispatch(
+            [&setup, &exceptions](Idx start, Idx stride, Idx n_math_models) {
+                for (Idx math_model_idx = start; math_model_idx < n_math_models; math_model_idx += stride) {
+                    try {
+                        setup(math_model_idx);
+                    } catch (...) {
+                        exceptions[math_model_idx] = std::current_exception();
+                    }
+                }
+            },
+            n_math_solvers_, n_math_solvers_ > 1 ? math_model_threading_ : sequential);
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+
     template <typename... Args, typename RunFn, typename SetupFn, typename WinddownFn, typename HandleExceptionFn,
               typename RecoverFromBadFn>
         requires std::invocable<std::remove_cvref_t<RunFn>, Args const&...> &&
@@ -732,31 +817,56 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
 
     // Calculate with optimization, e.g., automatic tap changer
     template <calculation_type_tag calculation_type, symmetry_tag sym> auto calculate(Options const& options) {
+        math_model_threading_ = options.threading;
         auto const calculator = [this, &options] {
             if constexpr (std::derived_from<calculation_type, power_flow_t>) {
+                if (options.optimizer_type == OptimizerType::automatic_tap_adjustment) {
+                    prepare_tap_param_tables<sym>();
+                }
                 return calculate_power_flow_<sym>(options.err_tol, options.max_iter);
             }
             assert(options.optimizer_type == OptimizerType::no_optimization);
             if constexpr (std::derived_from<calculation_type, state_estimation_t>) {
-                return calculate_state_estimation_<sym>(options.err_tol, options.max_iter);
+                return calculate_state_estimation_<sym>(options.err_tol, options.max_iter,
+                                                        options.state_estimation_tracking);
             }
             if constexpr (std::derived_from<calculation_type, short_circuit_t>) {
-                return calculate_short_circuit_<sym>(options.short_circuit_voltage_scaling);
+                return calculate_short_circuit_<sym>(options.short_circuit_voltage_scaling,
+                                                     options.short_circuit_fault_scan);
             }
             throw UnreachableHit{"MainModelImpl::calculate", "Unknown calculation type"};
         }();
 
-        SearchMethod const& search_method = options.optimizer_strategy == OptimizerStrategy::any
-                                                ? SearchMethod::linear_search
-                                                : SearchMethod::binary_search;
+        SearchMethod const search_method =
+            options.tap_search_method.value_or(options.optimizer_strategy == OptimizerStrategy::any
+                                                   ? SearchMethod::linear_search
+                                                   : SearchMethod::binary_search);
+
+        // speculatively evaluate candidate tap positions in parallel, on replicas of this model
+        auto const evaluate_candidates =
+            [this, &options]() -> optimizer::detail::candidate_evaluator_t<decltype(calculator), MainModelState> {
+            if constexpr (std::derived_from<calculation_type, power_flow_t>) {
+                if (options.speculative_tap_search && !is_sequential(options.threading)) {
+                    return [this, &options, replicas = std::make_shared<std::vector<MainModelImpl>>()](
+                               std::vector<ConstDataset> const& candidates, CalculationMethod method) {
+                        return calculate_power_flow_candidates_<sym>(*replicas, candidates, method, options);
+                    };
+                }
+            }
+            return {};
+        }();
 
-        return optimizer::get_optimizer<MainModelState, ConstDataset>(
-                   options.optimizer_type, options.optimizer_strategy, calculator,
-                   [this](ConstDataset const& update_data) {
-                       this->update_components<permanent_update_t>(update_data);
-                   },
-                   *meta_data_, search_method)
-            ->optimize(state_, options.calculation_method);
+        auto math_output =
+            optimizer::get_optimizer<MainModelState, ConstDataset>(
+                options.optimizer_type, options.optimizer_strategy, calculator,
+                [this](ConstDataset const& update_data) { this->update_components<permanent_update_t>(update_data); },
+                *meta_data_, search_method, evaluate_candidates,
+                options.tap_warm_start ? last_tap_positions_ : TransformerTapPositionOutput{}, &transformer_ranking_)
+                ->optimize(state_, options.calculation_method);
+        if (options.tap_warm_start) {
+            last_tap_positions_ = math_output.optimizer_output.transformer_tap_positions;
+        }
+        return math_output;
     }
 
     // Single calculation, propagating the results to result_data
@@ -767,8 +877,10 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             auto const faults = state_.components.template citer<Fault>();
             auto const is_three_phase = std::ranges::all_of(
                 faults, [](Fault const& fault) { return fault.get_fault_type() == FaultType::three_phase; });
-            options.calculation_symmetry =
-                is_three_phase ? CalculationSymmetry::symmetric : CalculationSymmetry::asymmetric;
+            // the fault scan also includes single phase to ground faults, which need an asymmetric calculation
+            options.calculation_symmetry = is_three_phase && !options.short_circuit_fault_scan
+                                               ? CalculationSymmetry::symmetric
+                                               : CalculationSymmetry::asymmetric;
         };
 
         calculation_type_symmetry_func_selector(
@@ -788,11 +900,22 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     // Batch calculation, propagating the results to result_data
     BatchParameter calculate(Options const& options, MutableDataset const& result_data,
                              ConstDataset const& update_data) {
+        // with multiple scenarios, the threads are used for the scenarios instead
+        bool const single_scenario = update_data.empty() || update_data.batch_size() == 1;
+        bool const speculative_tap_search = options.speculative_tap_search && single_scenario;
+        // the warm start only carries over between the scenarios of this batch
+        last_tap_positions_.clear();
+
         return batch_calculation_(
-            [&options](MainModelImpl& model, MutableDataset const& target_data, Idx pos) {
+            [&options, single_scenario, speculative_tap_search](MainModelImpl& model,
+                                                                MutableDataset const& target_data, Idx pos) {
                 auto sub_opt = options; // copy
+                // the math models of a scenario are set up sequentially when the scenarios run in parallel
+                sub_opt.threading = single_scenario || pos == ignore_output ? options.threading : sequential;
                 sub_opt.err_tol = pos != ignore_output ? options.err_tol : std::numeric_limits<double>::max();
                 sub_opt.max_iter = pos != ignore_output ? options.max_iter : 1;
+                sub_opt.speculative_tap_search = speculative_tap_search && pos != ignore_output;
+                sub_opt.tap_warm_start = options.tap_warm_start && pos != ignore_output;
 
                 model.calculate(sub_opt, target_data, pos);
             },
@@ -801,11 +924,34 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
 
     CalculationInfo calculation_info() const { return calculation_info_; }
 
+    // binary snapshot of the node ordering of the math models, the topology is built if it is not up to date
+    std::vector<char> get_topology_snapshot() {
+        assert(construction_complete_);
+        if (!is_topology_up_to_date_) {
+            rebuild_topology();
+        }
+        return serialize_topology_snapshot(
+            TopologySnapshot{.math_topology = state_.math_topology, .comp_coup = state_.topo_comp_coup});
+    }
+
+    // reuse the node ordering of a snapshot the next time the topology is built
+    void load_topology_snapshot(std::span<char const> data) {
+        assert(construction_complete_);
+        auto snapshot = deserialize_topology_snapshot(data);
+        if (snapshot.n_node() != state_.comp_topo->n_node_total()) {
+            throw SerializationError{"Topology snapshot was created for a model with a different number of nodes!\n"};
+        }
+        topology_snapshot_ = std::move(snapshot);
+    }
+
     void check_no_experimental_features_used(Options const& options) const {
         if (options.calculation_type == CalculationType::state_estimation &&
             state_.components.template size<GenericCurrentSensor>() > 0) {
             throw ExperimentalFeature{"State estimation", "current sensors"};
         }
+        if (options.state_estimation_tracking) {
+            throw ExperimentalFeature{"State estimation", "tracking mode"};
+        }
     }
 
   private:
@@ -853,6 +999,14 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     // math model
     MathState math_state_;
     Idx n_math_solvers_{0};
+    // Y bus and math solvers of the previous topology, reused for the math models unaffected by a topology change
+    MathState retained_math_state_;
+    // per math model, the sequence number of the unaffected math model in the previous topology, or -1 if none
+    IdxVector retained_math_model_idx_;
+    // node ordering loaded from a snapshot, used once when the topology is built
+    std::optional<TopologySnapshot> topology_snapshot_;
+    // threading of the current calculation, used to set up the Y bus and math solvers of the math models
+    Idx math_model_threading_{sequential};
     bool is_topology_up_to_date_{false};
     bool is_sym_parameter_up_to_date_{false};
     bool is_asym_parameter_up_to_date_{false};
@@ -862,6 +1016,13 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     OwnedUpdateDataset cached_inverse_update_{};
     UpdateChange cached_state_changes_{};
     std::array<std::vector<Idx2D>, main_core::utils::n_types<ComponentType...>> parameter_changed_components_{};
+    // per tap position parameters of the regulated transformers, built once when the tap positions are optimized
+    std::optional<main_core::TapParamTables<symmetric_t>> tap_param_tables_sym_;
+    std::optional<main_core::TapParamTables<asymmetric_t>> tap_param_tables_asym_;
+    // tap positions found in the last calculation with tap warm start
+    TransformerTapPositionOutput last_tap_positions_;
+    // ranking of the regulated transformers for the current topology, shared with the copies of the model in batches
+    optimizer::tap_position_optimizer::TransformerRankingCache transformer_ranking_;
 #ifndef NDEBUG
     // construction_complete is used for debug assertions only
     bool construction_complete_{false};
@@ -875,24 +1036,87 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         }
     }
 
-    template <symmetry_tag sym> std::vector<MathSolverProxy<sym>>& get_solvers() {
+    template <symmetry_tag sym> std::optional<main_core::TapParamTables<sym>>& get_tap_param_tables() {
+        if constexpr (is_symmetric_v<sym>) {
+            return tap_param_tables_sym_;
+        } else {
+            return tap_param_tables_asym_;
+        }
+    }
+    template <symmetry_tag sym> std::optional<main_core::TapParamTables<sym>> const& get_tap_param_tables() const {
         if constexpr (is_symmetric_v<sym>) {
-            return math_state_.math_solvers_sym;
+            return tap_param_tables_sym_;
         } else {
-            return math_state_.math_solvers_asym;
+            return tap_param_tables_asym_;
         }
     }
 
-    template <symmetry_tag sym> std::vector<YBus<sym>>& get_y_bus() {
+    template <symmetry_tag sym> void prepare_tap_param_tables() {
+        if constexpr (main_core::component_container_c<ComponentContainer, TransformerTapRegulator> &&
+                      main_core::component_container_c<ComponentContainer, Transformer> &&
+                      main_core::component_container_c<ComponentContainer, ThreeWindingTransformer>) {
+            // transformers can only be updated in tap position and status, so the tables never get outdated
+            if (auto& tables = get_tap_param_tables<sym>(); !tables.has_value()) {
+                tables = main_core::build_tap_param_tables<sym>(state_);
+            }
+        }
+    }
+
+    // calculation parameters of a branch or branch3, looked up in the tap parameter tables if available
+    template <typename CompType, symmetry_tag sym> auto calc_param(Idx2D const& component_idx) const {
+        auto const& component = main_core::get_component<CompType>(state_, component_idx);
+        if constexpr (std::same_as<CompType, Transformer> || std::same_as<CompType, ThreeWindingTransformer>) {
+            if (auto const& tables = get_tap_param_tables<sym>(); tables.has_value()) {
+                auto const& table = [&tables]() -> auto const& {
+                    if constexpr (std::same_as<CompType, Transformer>) {
+                        return tables->transformer;
+                    } else {
+                        return tables->three_winding_transformer;
+                    }
+                }()[main_core::get_component_sequence_idx<CompType>(state_, component_idx)];
+                if (auto const* param = table.has_value() ? table->find(component) : nullptr; param != nullptr) {
+                    return *param;
+                }
+            }
+        }
+        return component.template calc_param<sym>();
+    }
+
+    template <symmetry_tag sym> static std::vector<MathSolverProxy<sym>>& get_solvers(MathState& math_state) {
         if constexpr (is_symmetric_v<sym>) {
-            return math_state_.y_bus_vec_sym;
+            return math_state.math_solvers_sym;
         } else {
-            return math_state_.y_bus_vec_asym;
+            return math_state.math_solvers_asym;
         }
     }
+    template <symmetry_tag sym> std::vector<MathSolverProxy<sym>>& get_solvers() {
+        return get_solvers<sym>(math_state_);
+    }
+
+    template <symmetry_tag sym> static std::vector<YBus<sym>>& get_y_bus(MathState& math_state) {
+        if constexpr (is_symmetric_v<sym>) {
+            return math_state.y_bus_vec_sym;
+        } else {
+            return math_state.y_bus_vec_asym;
+        }
+    }
+    template <symmetry_tag sym> std::vector<YBus<sym>>& get_y_bus() { return get_y_bus<sym>(math_state_); }
+
+    // the sequence number of the unaffected math model in the previous topology of which the Y bus and math solver
+    // can be reused, or -1 if they have to be built
+    template <symmetry_tag sym> Idx get_retained_math_model(Idx math_model_idx) {
+        if (get_y_bus<sym>(retained_math_state_).empty() || get_solvers<sym>(retained_math_state_).empty()) {
+            return -1;
+        }
+        return retained_math_model_idx_[math_model_idx];
+    }
 
     void rebuild_topology() {
         assert(construction_complete_);
+        // keep the old math models, to reuse the ones that are not affected by the topology change
+        auto const old_math_topology = std::move(state_.math_topology);
+        auto const old_topo_comp_coup = std::move(state_.topo_comp_coup);
+        retained_math_state_ = std::move(math_state_);
         // clear old solvers
         reset_solvers();
         // get connection info
@@ -922,10 +1146,30 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         std::transform(state_.components.template citer<Source>().begin(),
                        state_.components.template citer<Source>().end(), comp_conn.source_connected.begin(),
                        [](Source const& source) { return source.status(); });
-        // re build
-        Topology topology{*state_.comp_topo, comp_conn};
+        // re build, reusing the node ordering of a loaded snapshot or the old math models where possible
+        auto topology = [this, &comp_conn, &old_math_topology, &old_topo_comp_coup] {
+            if (topology_snapshot_.has_value()) {
+                return Topology{*state_.comp_topo, comp_conn, topology_snapshot_->math_topology,
+                                *topology_snapshot_->comp_coup};
+            }
+            if (old_topo_comp_coup != nullptr) {
+                return Topology{*state_.comp_topo, comp_conn, old_math_topology, *old_topo_comp_coup};
+            }
+            return Topology{*state_.comp_topo, comp_conn};
+        }();
         std::tie(state_.math_topology, state_.topo_comp_coup) = topology.build_topology();
+        topology_snapshot_.reset();
         n_math_solvers_ = static_cast<Idx>(state_.math_topology.size());
+        retained_math_model_idx_ = old_topo_comp_coup == nullptr
+                                       ? IdxVector(n_math_solvers_, -1)
+                                       : find_unaffected_math_models(old_math_topology, *old_topo_comp_coup,
+                                                                     state_.math_topology, *state_.topo_comp_coup);
+        for (Idx i = 0; i != n_math_solvers_; ++i) {
+            if (Idx const retained_idx = retained_math_model_idx_[i]; retained_idx != -1) {
+                // the retained Y bus and math solver refer to the old math model topology
+                state_.math_topology[i] = old_math_topology[retained_idx];
+            }
+        }
         is_topology_up_to_date_ = true;
         is_sym_parameter_up_to_date_ = false;
         is_asym_parameter_up_to_date_ = false;
@@ -1036,6 +1280,48 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         return math_param_increment;
     }
 
+    // the parameters of the previous calculation with the same symmetry, with the changed components recalculated
+    template <symmetry_tag sym> std::vector<MathModelParam<sym>> get_updated_math_param() {
+        std::vector<MathModelParam<sym>> math_param;
+        math_param.reserve(n_math_solvers_);
+        std::ranges::transform(get_y_bus<sym>(), std::back_inserter(math_param),
+                               [](YBus<sym> const& y_bus) { return y_bus.math_model_param(); });
+
+        main_core::utils::run_functor_with_all_types_return_void<ComponentType...>([this, &math_param]<typename CT>() {
+            constexpr auto comp_index = main_core::utils::index_of_component<CT, ComponentType...>;
+            for (Idx2D const& changed_component_idx : std::get<comp_index>(parameter_changed_components_)) {
+                if constexpr (std::derived_from<CT, Branch>) {
+                    Idx2D const math_idx =
+                        state_.topo_comp_coup
+                            ->branch[main_core::get_component_sequence_idx<Branch>(state_, changed_component_idx)];
+                    if (math_idx.group != isolated_component) {
+                        math_param[math_idx.group].branch_param[math_idx.pos] =
+                            calc_param<CT, sym>(changed_component_idx);
+                    }
+                } else if constexpr (std::derived_from<CT, Branch3>) {
+                    Idx2DBranch3 const math_idx =
+                        state_.topo_comp_coup
+                            ->branch3[main_core::get_component_sequence_idx<Branch3>(state_, changed_component_idx)];
+                    if (math_idx.group != isolated_component) {
+                        auto const branch3_param = calc_param<CT, sym>(changed_component_idx);
+                        for (size_t branch2 = 0; branch2 < 3; ++branch2) {
+                            math_param[math_idx.group].branch_param[math_idx.pos[branch2]] = branch3_param[branch2];
+                        }
+                    }
+                } else if constexpr (std::same_as<CT, Shunt>) {
+                    Idx2D const math_idx =
+                        state_.topo_comp_coup
+                            ->shunt[main_core::get_component_sequence_idx<Shunt>(state_, changed_component_idx)];
+                    if (math_idx.group != isolated_component) {
+                        math_param[math_idx.group].shunt_param[math_idx.pos] =
+                            main_core::get_component<Shunt>(state_, changed_component_idx).template calc_param<sym>();
+                    }
+                }
+            }
+        });
+        return math_param;
+    }
+
     /** This is a heavily templated member function because it operates on many different variables of many
      *different types, but the essence is ever the same: filling one member (vector) of the calculation calc_input
      *struct (soa) with the right calculation symmetric or asymmetric calculation parameters, in the same order as
@@ -1126,16 +1412,18 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
         }
     }
 
-    template <symmetry_tag sym, IntSVector(StateEstimationInput<sym>::*component), class Component>
-    static void prepare_input_status(MainModelState const& state, std::vector<Idx2D> const& objects,
-                                     std::vector<StateEstimationInput<sym>>& input) {
-        for (Idx i = 0, n = narrow_cast<Idx>(objects.size()); i != n; ++i) {
-            Idx2D const math_idx = objects[i];
-            if (math_idx.group == isolated_component) {
-                continue;
+    // scatter a hot field array, indexed by component sequence, into the calculation input of the math models
+    template <calculation_input_type CalcStructOut, typename CalcParamOut,
+              std::vector<CalcParamOut>(CalcStructOut::*comp_vect)>
+    static void prepare_input_from_hot_fields(std::vector<Idx2D> const& components,
+                                              std::vector<CalcParamOut> const& hot_field,
+                                              std::vector<CalcStructOut>& calc_input) {
+        assert(components.size() == hot_field.size());
+        for (Idx i = 0, n = narrow_cast<Idx>(components.size()); i != n; ++i) {
+            Idx2D const math_idx = components[i];
+            if (math_idx.group != isolated_component) {
+                (calc_input[math_idx.group].*comp_vect)[math_idx.pos] = hot_field[i];
             }
-            (input[math_idx.group].*component)[math_idx.pos] =
-                main_core::get_component_by_sequence<Component>(state, i).status();
         }
     }
 
@@ -1146,11 +1434,11 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             pf_input[i].s_injection.resize(state.math_topology[i]->n_load_gen());
             pf_input[i].source.resize(state.math_topology[i]->n_source());
         }
-        prepare_input<PowerFlowInput<sym>, DoubleComplex, &PowerFlowInput<sym>::source, Source>(
-            state, state.topo_comp_coup->source, pf_input);
+        prepare_input_from_hot_fields<PowerFlowInput<sym>, DoubleComplex, &PowerFlowInput<sym>::source>(
+            state.topo_comp_coup->source, state.hot_fields.source_u_ref, pf_input);
 
-        prepare_input<PowerFlowInput<sym>, ComplexValue<sym>, &PowerFlowInput<sym>::s_injection, GenericLoadGen>(
-            state, state.topo_comp_coup->load_gen, pf_input);
+        prepare_input_from_hot_fields<PowerFlowInput<sym>, ComplexValue<sym>, &PowerFlowInput<sym>::s_injection>(
+            state.topo_comp_coup->load_gen, state.hot_fields.template load_gen_param<sym>(), pf_input);
 
         return pf_input;
     }
@@ -1175,12 +1463,12 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             se_input[i].measured_branch_to_current.resize(state.math_topology[i]->n_branch_to_current_sensor());
         }
 
-        prepare_input_status<sym, &StateEstimationInput<sym>::shunt_status, Shunt>(state, state.topo_comp_coup->shunt,
-                                                                                   se_input);
-        prepare_input_status<sym, &StateEstimationInput<sym>::load_gen_status, GenericLoadGen>(
-            state, state.topo_comp_coup->load_gen, se_input);
-        prepare_input_status<sym, &StateEstimationInput<sym>::source_status, Source>(
-            state, state.topo_comp_coup->source, se_input);
+        prepare_input_from_hot_fields<StateEstimationInput<sym>, IntS, &StateEstimationInput<sym>::shunt_status>(
+            state.topo_comp_coup->shunt, state.hot_fields.shunt_status, se_input);
+        prepare_input_from_hot_fields<StateEstimationInput<sym>, IntS, &StateEstimationInput<sym>::load_gen_status>(
+            state.topo_comp_coup->load_gen, state.hot_fields.load_gen_status, se_input);
+        prepare_input_from_hot_fields<StateEstimationInput<sym>, IntS, &StateEstimationInput<sym>::source_status>(
+            state.topo_comp_coup->source, state.hot_fields.source_status, se_input);
 
         prepare_input<StateEstimationInput<sym>, VoltageSensorCalcParam<sym>,
                       &StateEstimationInput<sym>::measured_voltage, GenericVoltageSensor>(
@@ -1239,7 +1527,8 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
     }
 
     template <symmetry_tag sym>
-    std::vector<ShortCircuitInput> prepare_short_circuit_input(ShortCircuitVoltageScaling voltage_scaling) {
+    std::vector<ShortCircuitInput> prepare_short_circuit_input(ShortCircuitVoltageScaling voltage_scaling,
+                                                               bool fault_scan) {
         // TODO(mgovers) split component mapping from actual preparing
         std::vector<IdxVector> topo_fault_indices(state_.math_topology.size());
         std::vector<IdxVector> topo_bus_indices(state_.math_topology.size());
@@ -1271,6 +1560,7 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             sc_input[i].fault_buses = {from_dense, std::move(map.indvector), state_.math_topology[i]->n_bus()};
             sc_input[i].faults.resize(state_.components.template size<Fault>());
             sc_input[i].source.resize(state_.math_topology[i]->n_source());
+            sc_input[i].fault_scan = fault_scan;
         }
 
         state_.comp_coup = ComponentToMathCoupling{.fault = std::move(fault_coup)};
@@ -1305,21 +1595,40 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             constexpr auto shunt_param_in_seq_map =
                 std::array{main_core::utils::index_of_component<Shunt, ComponentType...>};
 
-            for (Idx i = 0; i != n_math_solvers_; ++i) {
+            // build the Y bus of the affected math models
+            std::vector<std::optional<YBus<sym>>> new_y_bus(n_math_solvers_);
+            math_model_dispatch([this, &new_y_bus, &math_params, &other_y_bus_vec, other_y_bus_exist,
+                                 &branch_param_in_seq_map, &shunt_param_in_seq_map](Idx i) {
+                if (get_retained_math_model<sym>(i) != -1) {
+                    return;
+                }
                 // construct from existing Y_bus structure if possible
                 if (other_y_bus_exist) {
-                    y_bus_vec.emplace_back(state_.math_topology[i],
-                                           std::make_shared<MathModelParam<sym> const>(std::move(math_params[i])),
-                                           other_y_bus_vec[i].get_y_bus_structure());
+                    new_y_bus[i].emplace(state_.math_topology[i],
+                                         std::make_shared<MathModelParam<sym> const>(std::move(math_params[i])),
+                                         other_y_bus_vec[i].get_y_bus_structure());
                 } else {
-                    y_bus_vec.emplace_back(state_.math_topology[i],
-                                           std::make_shared<MathModelParam<sym> const>(std::move(math_params[i])));
+                    new_y_bus[i].emplace(state_.math_topology[i],
+                                         std::make_shared<MathModelParam<sym> const>(std::move(math_params[i])));
                 }
 
-                y_bus_vec.back().set_branch_param_idx(
+                new_y_bus[i]->set_branch_param_idx(
                     IdxVector{branch_param_in_seq_map.begin(), branch_param_in_seq_map.end()});
-                y_bus_vec.back().set_shunt_param_idx(
+                new_y_bus[i]->set_shunt_param_idx(
                     IdxVector{shunt_param_in_seq_map.begin(), shunt_param_in_seq_map.end()});
+            });
+
+            for (Idx i = 0; i != n_math_solvers_; ++i) {
+                // reuse the Y bus of an unaffected math model, only updating the admittance if the parameters changed
+                if (Idx const retained_idx = get_retained_math_model<sym>(i); retained_idx != -1) {
+                    y_bus_vec.push_back(std::move(get_y_bus<sym>(retained_math_state_)[retained_idx]));
+                    if (y_bus_vec.back().math_model_param() != math_params[i]) {
+                        y_bus_vec.back().update_admittance(
+                            std::make_shared<MathModelParam<sym> const>(std::move(math_params[i])));
+                    }
+                    continue;
+                }
+                y_bus_vec.push_back(std::move(*new_y_bus[i]));
             }
         }
     }
@@ -1337,24 +1646,36 @@ class MainModelImpl<ExtraRetrievableTypes<ExtraRetrievableType...>, ComponentLis
             assert(n_math_solvers_ == static_cast<Idx>(state_.math_topology.size()));
             assert(n_math_solvers_ == static_cast<Idx>(get_y_bus<sym>().size()));
 
+            // create the math solvers of the affected math models
+            std::vector<std::optional<MathSolverProxy<sym>>> new_solvers(n_math_solvers_);
+            math_model_dispatch([this, &new_solvers](Idx idx) {
+                if (get_retained_math_model<sym>(idx) == -1) {
+                    new_solvers[idx].emplace(math_solver_dispatcher_, state_.math_topology[idx]);
+                }
+            });
+
             solvers.clear();
             solvers.reserve(n_math_solvers_);
-            std::ranges::transform(state_.math_topology, std::back_inserter(solvers), [this](auto const& math_topo) {
-                return MathSolverProxy<sym>{math_solver_dispatcher_, math_topo};
-            });
             for (Idx idx = 0; idx < n_math_solvers_; ++idx) {
+                // the math solver of an unaffected math model keeps its factorization, and is already registered at
+                // the reused Y bus
+                if (Idx const retained_idx = get_retained_math_model<sym>(idx); retained_idx != -1) {
+                    solvers.push_back(std::move(get_solvers<sym>(retained_math_state_)[retained_idx]));
+                    continue;
+                }
+                solvers.push_back(std::move(*new_solvers[idx]));
+                // the math solver itself does not move with the proxy, so it can be referenced when reused
                 get_y_bus<sym>()[idx].register_parameters_changed_callback(
-                    [solver = std::ref(solvers[idx])](bool changed) {
-                        solver.get().get().parameters_changed(changed);
-                    });
+                    [&solver = solvers.back().get()](bool changed) { solver.parameters_changed(changed); });
             }
+            get_y_bus<sym>(retained_math_state_).clear();
+            get_solvers<sym>(retained_math_state_).clear();
         } else if (!is_parameter_up_to_date<sym>()) {
-            std::vector<MathModelParam<sym>> const math_params = get_math_param<sym>();
-            std::vector<MathModelParamIncrement> const math_param_increments = get_math_param_increment<sym>();
             if (last_updated_calculation_symmetry_mode_ == is_symmetric_v<sym>) {
-                main_core::update_y_bus(math_state_, math_params, math_param_increments);
+                // only the changed components need to be recalculated
+                main_core::update_y_bus(math_state_, get_updated_math_param<sym>(), get_math_param_increment<sym>());
             } else {
-                main_core::update_y_bus(math_state_, math_params);
+                main_core::update_y_bus(math_state_, get_math_param<sym>());
             }
         }
         // else do nothing, set everything up to date
@@ -10,6 +10,7 @@
 #include "common_solver_functions.hpp"
 #include "measured_values.hpp"
 #include "observability.hpp"
+#include "sparse_ldl_solver.hpp"
 #include "sparse_lu_solver.hpp"
 #include "y_bus.hpp"
 
@@ -47,6 +48,7 @@ template <symmetry_tag sym> using ILSERhs = ILSEUnknown<sym>;
 //    [G, QH]
 //    [Q, R ]
 // ]
+// the gain matrix is hermitian, block(i, j) = block(j, i)^H
 template <symmetry_tag sym> class ILSEGainBlock : public Block<DoubleComplex, sym, true, 2> {
   public:
     template <int r, int c> using GetterType = typename Block<DoubleComplex, sym, true, 2>::template GetterType<r, c>;
@@ -74,12 +76,16 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
     static constexpr Idx bsr_block_size_ = is_symmetric_v<sym> ? 2 : 6;
 
   public:
-    IterativeLinearSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr)
+    IterativeLinearSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr,
+                            std::shared_ptr<ObservabilityCache> observability_cache = {})
         : n_bus_{y_bus.size()},
           math_topo_{std::move(topo_ptr)},
-          data_gain_(y_bus.nnz_lu()),
+          observability_cache_{observability_cache ? std::move(observability_cache)
+                                                   : std::make_shared<ObservabilityCache>()},
+          data_gain_(y_bus.nnz_ldl()),
           x_rhs_(y_bus.size()),
-          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
+          sparse_ldl_solver_{y_bus.shared_indptr_ldl(), y_bus.shared_indices_ldl(), y_bus.shared_diag_ldl()},
+          sparse_lu_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
           perm_(y_bus.size()) {}
 
     SolverOutput<sym> run_state_estimation(YBus<sym> const& y_bus, StateEstimationInput<sym> const& input,
@@ -98,20 +104,45 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
         sub_timer = Timer(calculation_info, 2221, "Pre-process measured value");
         MeasuredValues<sym> const measured_values{y_bus.shared_topology(), input};
         auto const observability_result =
-            necessary_observability_check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
-
-        // prepare matrix
-        sub_timer = Timer(calculation_info, 2222, "Prepare matrix, including pre-factorization");
-        prepare_matrix(y_bus, measured_values);
-        // prefactorize
-        sparse_solver_.prefactorize(data_gain_, perm_, observability_result.use_perturbation());
+            observability_cache_->check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
+
+        // prepare matrix, only if the admittance, the sensor presence or the variances changed
+        // otherwise the pre-factorized gain matrix of the previous calculation is re-used
+        // the admittance is compared by its version, the cache does not rely on being signalled by the Y bus
+        if (auto gain_matrix_key = make_gain_matrix_key(measured_values, observability_result.use_perturbation());
+            parameters_changed_ || y_bus.admittance_version() != gain_matrix_admittance_version_ ||
+            gain_matrix_key != gain_matrix_key_) {
+            sub_timer = Timer(calculation_info, 2222, "Prepare matrix, including pre-factorization");
+            // invalidate the cache first, the pre-factorization can throw halfway
+            gain_matrix_key_.clear();
+            prepare_matrix(y_bus, measured_values);
+            // prefactorize
+            // the LDL^H factorization cannot perturb pivots, fall back to LU when perturbation is needed
+            use_lu_ = observability_result.use_perturbation();
+            if (use_lu_) {
+                expand_gain_matrix(y_bus);
+                sparse_lu_solver_.prefactorize(data_gain_lu_, perm_, true);
+            } else {
+                data_gain_lu_ = {};
+                sparse_ldl_solver_.prefactorize(data_gain_, perm_);
+            }
+            gain_matrix_key_ = std::move(gain_matrix_key);
+            gain_matrix_admittance_version_ = y_bus.admittance_version();
+            parameters_changed_ = false;
+        }
 
         // initialize voltage with initial angle
+        // in tracking mode, start from the previous estimate if the previous calculation succeeded
         sub_timer = Timer(calculation_info, 2223, "Initialize voltages");
-        RealValue<sym> const mean_angle_shift = measured_values.mean_angle_shift();
-        for (Idx bus = 0; bus != n_bus_; ++bus) {
-            output.u[bus] = exp(1.0i * (mean_angle_shift + math_topo_->phase_shift[bus]));
+        if (tracking_ && !previous_u_.empty()) {
+            output.u = previous_u_;
+        } else {
+            RealValue<sym> const mean_angle_shift = measured_values.mean_angle_shift();
+            for (Idx bus = 0; bus != n_bus_; ++bus) {
+                output.u[bus] = exp(1.0i * (mean_angle_shift + math_topo_->phase_shift[bus]));
+            }
         }
+        previous_u_.clear();
 
         // loop to iterate
         Idx num_iter = 0;
@@ -123,7 +154,7 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
             prepare_rhs(y_bus, measured_values, output.u);
             // solve with prefactorization
             sub_timer = Timer(calculation_info, 2225, "Solve sparse linear equation (pre-factorized)");
-            sparse_solver_.solve_with_prefactorized_matrix(data_gain_, perm_, x_rhs_, x_rhs_);
+            solve_with_prefactorized_matrix();
             sub_timer = Timer(calculation_info, 2226, "Iterate unknown");
             max_dev = iterate_unknown(output.u, measured_values.has_angle());
         };
@@ -139,9 +170,22 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
         auto const key = Timer::make_key(2228, "Max number of iterations");
         calculation_info[key] = std::max(calculation_info[key], static_cast<double>(num_iter));
 
+        if (tracking_) {
+            previous_u_ = output.u;
+        }
         return output;
     }
 
+    void parameters_changed(bool changed) { parameters_changed_ = parameters_changed_ || changed; }
+
+    // tracking mode: each calculation starts from the estimate of the previous successful calculation
+    void set_tracking(bool tracking) {
+        tracking_ = tracking;
+        if (!tracking_) {
+            previous_u_ = {};
+        }
+    }
+
   private:
     // array selection function pointer
     static constexpr std::array has_branch_power_{&MeasuredValues<sym>::has_branch_from_power,
@@ -156,14 +200,26 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
     Idx n_bus_;
     // shared topo data
     std::shared_ptr<MathModelTopology const> math_topo_;
+    std::shared_ptr<ObservabilityCache> observability_cache_;
 
-    // data for gain matrix
+    // data for gain matrix, only the upper triangle in ldl structure
     std::vector<ILSEGainBlock<sym>> data_gain_;
+    // full gain matrix in lu structure, only allocated when the LU fallback is used
+    std::vector<ILSEGainBlock<sym>> data_gain_lu_;
     // unknown and rhs
     std::vector<ILSERhs<sym>> x_rhs_;
     // solver
-    SparseLUSolver<ILSEGainBlock<sym>, ILSERhs<sym>, ILSEUnknown<sym>> sparse_solver_;
+    SparseLDLSolver<ILSEGainBlock<sym>, ILSERhs<sym>, ILSEUnknown<sym>> sparse_ldl_solver_;
+    SparseLUSolver<ILSEGainBlock<sym>, ILSERhs<sym>, ILSEUnknown<sym>> sparse_lu_solver_;
     typename SparseLUSolver<ILSEGainBlock<sym>, ILSERhs<sym>, ILSEUnknown<sym>>::BlockPermArray perm_;
+    bool use_lu_{false};
+    // cache of the pre-factorized gain matrix
+    bool parameters_changed_{true};
+    uint64_t gain_matrix_admittance_version_{};
+    std::vector<double> gain_matrix_key_;
+    // tracking mode
+    bool tracking_{false};
+    ComplexValueVector<sym> previous_u_;
 
     static auto diagonal_inverse(RealValue<sym> const& value) {
         return ComplexDiagonalTensor<sym>{static_cast<ComplexValue<sym>>(RealValue<sym>{1.0} / value)};
@@ -173,13 +229,15 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
         MathModelParam<sym> const& param = y_bus.math_model_param();
         IdxVector const& row_indptr = y_bus.row_indptr_lu();
         IdxVector const& col_indices = y_bus.col_indices_lu();
+        IdxVector const& lu_diag = y_bus.lu_diag();
+        IdxVector const& row_indptr_ldl = y_bus.row_indptr_ldl();
 
-        // loop data index, all rows and columns
+        // loop data index, all rows and columns in the upper triangle
         for (Idx row = 0; row != n_bus_; ++row) {
-            for (Idx data_idx_lu = row_indptr[row]; data_idx_lu != row_indptr[row + 1]; ++data_idx_lu) {
+            for (Idx data_idx_lu = lu_diag[row]; data_idx_lu != row_indptr[row + 1]; ++data_idx_lu) {
                 Idx const col = col_indices[data_idx_lu];
                 // get a reference and reset block to zero
-                ILSEGainBlock<sym>& block = data_gain_[data_idx_lu];
+                ILSEGainBlock<sym>& block = data_gain_[data_idx_lu - lu_diag[row] + row_indptr_ldl[row]];
                 block.clear();
                 // get data idx of y bus,
                 // skip for a fill-in
@@ -262,18 +320,99 @@ template <symmetry_tag sym_type> class IterativeLinearSESolver {
                         block.r() = ComplexTensor<sym>{-1.0};
                     }
                 }
+                // QH_ij is the hermitian transpose of Q_ji
+                // Q_ji = Y_bus_ji if injection measurement exists in the transpose row, otherwise 0
+                if (measured_value.has_bus_injection(col)) {
+                    Idx const data_idx_transpose = y_bus.map_lu_y_bus()[y_bus.lu_transpose_entry()[data_idx_lu]];
+                    block.qh() = hermitian_transpose(y_bus.admittance()[data_idx_transpose]);
+                }
+            }
+        }
+    }
+
+    // the gain matrix only depends on the admittance, the sensor presence and the (normalized) variances
+    // the measured values themselves only enter the rhs
+    // the key lists the variances of all measured quantities in a fixed order, with a negative entry if not measured
+    // the admittance is tracked separately by its version
+    std::vector<double> make_gain_matrix_key(MeasuredValues<sym> const& measured_value, bool use_perturbation) const {
+        static constexpr double not_measured = -1.0;
+        std::vector<double> key;
+        key.reserve(2 * n_bus_ + math_topo_->n_shunt() + 4 * math_topo_->n_branch() + 1);
+
+        auto const add_variance = [&key](RealValue<sym> const& variance) {
+            if constexpr (is_symmetric_v<sym>) {
+                key.push_back(variance);
+            } else {
+                for (Idx const phase : {0, 1, 2}) {
+                    key.push_back(variance(phase));
+                }
+            }
+        };
+        auto const add_measurement = [&key, &add_variance](bool has_measurement, auto const& get_measurement) {
+            if (!has_measurement) {
+                key.push_back(not_measured);
+                return;
+            }
+            auto const& measurement = get_measurement();
+            add_variance(measurement.real_component.variance);
+            add_variance(measurement.imag_component.variance);
+        };
+
+        key.push_back(use_perturbation ? 1.0 : 0.0);
+        for (Idx bus = 0; bus != n_bus_; ++bus) {
+            key.push_back(measured_value.has_voltage(bus) ? measured_value.voltage_var(bus) : not_measured);
+            add_measurement(measured_value.has_bus_injection(bus),
+                            [&]() -> auto const& { return measured_value.bus_injection(bus); });
+        }
+        for (Idx shunt = 0; shunt != math_topo_->n_shunt(); ++shunt) {
+            add_measurement(measured_value.has_shunt(shunt),
+                            [&]() -> auto const& { return measured_value.shunt_power(shunt); });
+        }
+        for (Idx branch = 0; branch != math_topo_->n_branch(); ++branch) {
+            for (IntS const measured_side : std::array<IntS, 2>{0, 1}) {
+                add_measurement(
+                    std::invoke(has_branch_power_[measured_side], measured_value, branch),
+                    [&]() -> auto const& { return std::invoke(branch_power_[measured_side], measured_value, branch); });
+                add_measurement(std::invoke(has_branch_current_[measured_side], measured_value, branch),
+                                [&]() -> auto const& {
+                                    return std::invoke(branch_current_[measured_side], measured_value, branch)
+                                        .measurement;
+                                });
             }
         }
+        return key;
+    }
 
-        // loop all transpose entry for QH
-        // assign the hermitian transpose of the transpose entry of Q
-        for (Idx data_idx_lu = 0; data_idx_lu != y_bus.nnz_lu(); ++data_idx_lu) {
-            // skip for fill-in
-            if (y_bus.map_lu_y_bus()[data_idx_lu] == -1) {
-                continue;
+    // fill the full gain matrix in lu structure from the upper triangle, for the LU fallback
+    void expand_gain_matrix(YBus<sym> const& y_bus) {
+        IdxVector const& row_indptr = y_bus.row_indptr_lu();
+        IdxVector const& col_indices = y_bus.col_indices_lu();
+        IdxVector const& lu_diag = y_bus.lu_diag();
+        IdxVector const& row_indptr_ldl = y_bus.row_indptr_ldl();
+        auto const ldl_idx = [&](Idx row, Idx data_idx_lu) {
+            return data_idx_lu - lu_diag[row] + row_indptr_ldl[row];
+        };
+
+        data_gain_lu_.resize(y_bus.nnz_lu());
+        for (Idx row = 0; row != n_bus_; ++row) {
+            for (Idx data_idx_lu = row_indptr[row]; data_idx_lu != row_indptr[row + 1]; ++data_idx_lu) {
+                Idx const col = col_indices[data_idx_lu];
+                if (col >= row) {
+                    data_gain_lu_[data_idx_lu] = data_gain_[ldl_idx(row, data_idx_lu)];
+                } else {
+                    // block_ij = block_ji^H
+                    Idx const data_idx_transpose = y_bus.lu_transpose_entry()[data_idx_lu];
+                    data_gain_lu_[data_idx_lu] = hermitian_transpose(data_gain_[ldl_idx(col, data_idx_transpose)]);
+                }
             }
-            Idx const data_idx_tranpose = y_bus.lu_transpose_entry()[data_idx_lu];
-            data_gain_[data_idx_lu].qh() = hermitian_transpose(data_gain_[data_idx_tranpose].q());
+        }
+    }
+
+    void solve_with_prefactorized_matrix() {
+        if (use_lu_) {
+            sparse_lu_solver_.solve_with_prefactorized_matrix(data_gain_lu_, perm_, x_rhs_, x_rhs_);
+        } else {
+            sparse_ldl_solver_.solve_with_prefactorized_matrix(data_gain_, perm_, x_rhs_, x_rhs_);
         }
     }
 
@@ -10,6 +10,7 @@
 #include "math_solver_dispatch.hpp"
 #include "newton_raphson_pf_solver.hpp"
 #include "newton_raphson_se_solver.hpp"
+#include "observability.hpp"
 #include "short_circuit_solver.hpp"
 #include "y_bus.hpp"
 
@@ -29,6 +30,7 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
   public:
     explicit MathSolver(std::shared_ptr<MathModelTopology const> const& topo_ptr)
         : topo_ptr_{topo_ptr},
+          observability_cache_{std::make_shared<ObservabilityCache>()},
           all_const_y_{std::all_of(topo_ptr->load_gen_type.cbegin(), topo_ptr->load_gen_type.cend(),
                                    [](LoadGenType x) { return x == LoadGenType::const_y; })} {}
 
@@ -104,11 +106,27 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         if (iterative_current_pf_solver_.has_value()) {
             iterative_current_pf_solver_->parameters_changed(changed);
         }
+        if (iterative_linear_se_solver_.has_value()) {
+            iterative_linear_se_solver_->parameters_changed(changed);
+        }
+    }
+
+    void set_state_estimation_tracking(bool tracking) final {
+        state_estimation_tracking_ = tracking;
+        if (iterative_linear_se_solver_.has_value()) {
+            iterative_linear_se_solver_->set_tracking(tracking);
+        }
+        if (newton_raphson_se_solver_.has_value()) {
+            newton_raphson_se_solver_->set_tracking(tracking);
+        }
     }
 
   private:
     std::shared_ptr<MathModelTopology const> topo_ptr_;
+    // shared by all copies of this solver, e.g. in a batch calculation
+    std::shared_ptr<ObservabilityCache> observability_cache_;
     bool all_const_y_; // if all the load_gen is const element_admittance (impedance) type
+    bool state_estimation_tracking_{false};
     std::optional<NewtonRaphsonPFSolver<sym>> newton_raphson_pf_solver_;
     std::optional<LinearPFSolver<sym>> linear_pf_solver_;
     std::optional<IterativeCurrentPFSolver<sym>> iterative_current_pf_solver_;
@@ -156,7 +174,8 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         // construct model if needed
         if (!iterative_linear_se_solver_.has_value()) {
             Timer const timer(calculation_info, 2210, "Create math solver");
-            iterative_linear_se_solver_.emplace(y_bus, topo_ptr_);
+            iterative_linear_se_solver_.emplace(y_bus, topo_ptr_, observability_cache_);
+            iterative_linear_se_solver_->set_tracking(state_estimation_tracking_);
         }
 
         // call calculation
@@ -170,7 +189,8 @@ template <symmetry_tag sym> class MathSolver : public MathSolverBase<sym> {
         // construct model if needed
         if (!newton_raphson_se_solver_.has_value()) {
             Timer const timer(calculation_info, 2210, "Create math solver");
-            newton_raphson_se_solver_.emplace(y_bus, topo_ptr_);
+            newton_raphson_se_solver_.emplace(y_bus, topo_ptr_, observability_cache_);
+            newton_raphson_se_solver_->set_tracking(state_estimation_tracking_);
         }
 
         // call calculation
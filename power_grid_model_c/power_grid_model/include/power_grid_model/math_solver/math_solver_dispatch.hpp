@@ -41,6 +41,7 @@ template <symmetry_tag sym> class MathSolverBase {
                                                             YBus<sym> const& y_bus) = 0;
     virtual void clear_solver() = 0;
     virtual void parameters_changed(bool changed) = 0;
+    virtual void set_state_estimation_tracking(bool tracking) = 0;
 
   protected:
     MathSolverBase() = default;
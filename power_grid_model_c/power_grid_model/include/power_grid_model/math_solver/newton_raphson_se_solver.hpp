@@ -10,6 +10,8 @@
 #include "common_solver_functions.hpp"
 #include "measured_values.hpp"
 #include "observability.hpp"
+#include "sparse_ldl_solver.hpp"
+#include "sparse_lu_solver.hpp"
 #include "y_bus.hpp"
 
 #include "../calculation_parameters.hpp"
@@ -48,6 +50,7 @@ template <symmetry_tag sym> using NRSERhs = NRSEUnknown<sym>;
 //    [G, Q^T]
 //    [Q, R  ]
 // ]
+// the gain matrix is symmetric, block(i, j) = block(j, i)^T
 template <symmetry_tag sym> class NRSEGainBlock : public Block<double, sym, true, 4> {
   public:
     template <int r, int c> using GetterType = typename Block<double, sym, true, 4>::template GetterType<r, c>;
@@ -137,13 +140,17 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
     };
 
   public:
-    NewtonRaphsonSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr)
+    NewtonRaphsonSESolver(YBus<sym> const& y_bus, std::shared_ptr<MathModelTopology const> topo_ptr,
+                          std::shared_ptr<ObservabilityCache> observability_cache = {})
         : n_bus_{y_bus.size()},
           math_topo_{std::move(topo_ptr)},
+          observability_cache_{observability_cache ? std::move(observability_cache)
+                                                   : std::make_shared<ObservabilityCache>()},
           data_gain_(y_bus.nnz_lu()),
           delta_x_rhs_(y_bus.size()),
           x_(y_bus.size()),
-          sparse_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
+          sparse_ldl_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
+          sparse_lu_solver_{y_bus.shared_indptr_lu(), y_bus.shared_indices_lu(), y_bus.shared_diag_lu()},
           perm_(y_bus.size()) {}
 
     SolverOutput<sym> run_state_estimation(YBus<sym> const& y_bus, StateEstimationInput<sym> const& input,
@@ -162,11 +169,17 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
         sub_timer = Timer(calculation_info, 2221, "Pre-process measured value");
         MeasuredValues<sym> const measured_values{y_bus.shared_topology(), input};
         auto const observability_result =
-            necessary_observability_check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
+            observability_cache_->check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
 
         // initialize voltage with initial angle
+        // in tracking mode, start from the previous estimate if the previous calculation succeeded
         sub_timer = Timer(calculation_info, 2223, "Initialize voltages");
-        initialize_unknown(output.u, measured_values);
+        if (tracking_ && has_previous_estimate_) {
+            initialize_unknown_from_previous_estimate(output.u);
+        } else {
+            initialize_unknown(output.u, measured_values);
+        }
+        has_previous_estimate_ = false;
 
         // loop to iterate
         Idx num_iter = 0;
@@ -178,8 +191,12 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
             prepare_matrix_and_rhs(y_bus, measured_values, output.u);
             // solve with prefactorization
             sub_timer = Timer(calculation_info, 2225, "Solve sparse linear equation");
-            sparse_solver_.prefactorize_and_solve(data_gain_, perm_, delta_x_rhs_, delta_x_rhs_,
-                                                  observability_result.use_perturbation());
+            // the LDL^H factorization cannot perturb pivots, fall back to LU when perturbation is needed
+            if (observability_result.use_perturbation()) {
+                sparse_lu_solver_.prefactorize_and_solve(data_gain_, perm_, delta_x_rhs_, delta_x_rhs_, true);
+            } else {
+                sparse_ldl_solver_.prefactorize_and_solve(data_gain_, perm_, delta_x_rhs_, delta_x_rhs_);
+            }
             sub_timer = Timer(calculation_info, 2226, "Iterate unknown");
             max_dev = iterate_unknown(output.u, measured_values);
         };
@@ -195,23 +212,36 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
         auto const key = Timer::make_key(2228, "Max number of iterations");
         calculation_info[key] = std::max(calculation_info[key], static_cast<double>(num_iter));
 
+        has_previous_estimate_ = tracking_;
         return output;
     }
 
+    // tracking mode: each calculation starts from the estimate of the previous successful calculation
+    void set_tracking(bool tracking) {
+        tracking_ = tracking;
+        has_previous_estimate_ = has_previous_estimate_ && tracking_;
+    }
+
   private:
     Idx n_bus_;
     // shared topo data
     std::shared_ptr<MathModelTopology const> math_topo_;
+    std::shared_ptr<ObservabilityCache> observability_cache_;
 
     // data for gain matrix
+    // the full matrix is needed to assemble the rhs, the LDL^H factorization only uses the upper triangle
     std::vector<NRSEGainBlock<sym>> data_gain_;
     // unknown and rhs
     std::vector<NRSERhs<sym>> delta_x_rhs_;
     // voltage of current iteration
     std::vector<NRSERhs<sym>> x_;
     // solver
-    SparseLUSolver<NRSEGainBlock<sym>, NRSERhs<sym>, NRSEUnknown<sym>> sparse_solver_;
+    SparseLDLSolver<NRSEGainBlock<sym>, NRSERhs<sym>, NRSEUnknown<sym>> sparse_ldl_solver_;
+    SparseLUSolver<NRSEGainBlock<sym>, NRSERhs<sym>, NRSEUnknown<sym>> sparse_lu_solver_;
     typename SparseLUSolver<NRSEGainBlock<sym>, NRSERhs<sym>, NRSEUnknown<sym>>::BlockPermArray perm_;
+    // tracking mode, the previous estimate is kept in x_
+    bool tracking_{false};
+    bool has_previous_estimate_{false};
 
     void initialize_unknown(ComplexValueVector<sym>& initial_u, MeasuredValues<sym> const& measured_values) {
         using statistics::detail::cabs_or_real;
@@ -232,6 +262,17 @@ template <symmetry_tag sym_type> class NewtonRaphsonSESolver {
         }
     }
 
+    // keep the voltage of the previous estimate
+    // the lagrange multipliers are reset, because the zero injection constraints may have changed
+    void initialize_unknown_from_previous_estimate(ComplexValueVector<sym>& initial_u) {
+        for (Idx bus = 0; bus != n_bus_; ++bus) {
+            auto& estimated_result = x_[bus];
+            estimated_result.phi_p() = 0.0;
+            estimated_result.phi_q() = 0.0;
+            initial_u[bus] = estimated_result.v() * exp(1.0i * estimated_result.theta());
+        }
+    }
+
     void reset_unknown() {
         auto const default_unknown = [] {
             NRSERhs<sym> x;
@@ -9,6 +9,9 @@
 
 #include "../common/exception.hpp"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace power_grid_model::math_solver {
 
 namespace detail {
@@ -178,4 +181,69 @@ inline ObservabilityResult necessary_observability_check(MeasuredValues<sym> con
     return result;
 }
 
+// cache of the observability check results of one math model topology
+// the result only depends on which sensors are present and which voltage sensors have an angle measurement,
+//    not on the measured values or the variances
+// the results are keyed by that sensor presence pattern
+// the cache can be shared by the copies of a math solver in a batch calculation, the access is thread-safe
+// only observable results are cached, the check is repeated for unobservable patterns to raise the error
+class ObservabilityCache {
+  public:
+    // clear the cache when the number of patterns exceeds this limit, to bound the memory usage
+    static constexpr Idx max_n_patterns = 64;
+
+    template <symmetry_tag sym>
+    ObservabilityResult check(MeasuredValues<sym> const& measured_values, MathModelTopology const& topo,
+                              YBusStructure const& y_bus_structure) {
+        auto pattern = sensor_presence_pattern(measured_values, topo);
+        {
+            std::scoped_lock const lock{mutex_};
+            if (auto const found = results_.find(pattern); found != results_.cend()) {
+                return found->second;
+            }
+        }
+        // run the check outside the lock, it throws if the system is not observable
+        ObservabilityResult const result = necessary_observability_check(measured_values, topo, y_bus_structure);
+        std::scoped_lock const lock{mutex_};
+        if (std::ssize(results_) >= max_n_patterns) {
+            results_.clear();
+        }
+        results_.try_emplace(std::move(pattern), result);
+        return result;
+    }
+
+    Idx size() const {
+        std::scoped_lock const lock{mutex_};
+        return std::ssize(results_);
+    }
+
+  private:
+    mutable std::mutex mutex_;
+    std::unordered_map<std::vector<bool>, ObservabilityResult> results_;
+
+    // per bus: voltage sensor, voltage angle measurement, injection sensor
+    // per branch: any flow sensor on any side
+    // global: any current sensor with global angle
+    template <symmetry_tag sym>
+    static std::vector<bool> sensor_presence_pattern(MeasuredValues<sym> const& measured_values,
+                                                     MathModelTopology const& topo) {
+        std::vector<bool> pattern;
+        pattern.reserve(3 * topo.n_bus() + topo.n_branch() + 1);
+        for (Idx bus = 0; bus != topo.n_bus(); ++bus) {
+            bool const has_voltage = measured_values.has_voltage(bus);
+            pattern.push_back(has_voltage);
+            pattern.push_back(has_voltage && measured_values.has_angle_measurement(bus));
+            pattern.push_back(measured_values.has_bus_injection(bus));
+        }
+        for (Idx branch = 0; branch != topo.n_branch(); ++branch) {
+            pattern.push_back(measured_values.has_branch_from_power(branch) ||
+                              measured_values.has_branch_to_power(branch) ||
+                              measured_values.has_branch_from_current(branch) ||
+                              measured_values.has_branch_to_current(branch));
+        }
+        pattern.push_back(measured_values.has_global_angle_current());
+        return pattern;
+    }
+};
+
 } // namespace power_grid_model::math_solver
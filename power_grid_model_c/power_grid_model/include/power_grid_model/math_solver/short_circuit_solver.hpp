@@ -57,6 +57,58 @@ template <symmetry_tag sym> class ShortCircuitSolver {
         // post processing
         calculate_result(y_bus, input, output, infinite_admittance_fault_counter, fault_type, phase_1, phase_2);
 
+        // the fault scan factorizes the matrix again, without the faults
+        if (input.fault_scan) {
+            output.fault_scan = run_fault_scan(y_bus, input.source);
+        }
+
+        return output;
+    }
+
+    // fault scan of bolted faults at the given buses, all buses if empty
+    // the matrix Y_bus + Y_source is factorized only once, without any fault
+    //    the pre-fault voltage is the solution with the source injections
+    //    the Thevenin impedance is the diagonal block of Z_bus = (Y_bus + Y_source)^-1, by selected inversion
+    // for a bolted fault at bus k, the fault currents follow from U_pre,k - Z_k,k * I_fault = 0 at the faulted phases
+    //    three phase: I_fault = Z_k,k^-1 * U_pre,k
+    //    single phase to ground in phase p: I_fault(p) = U_pre,k(p) / Z_k,k(p, p)
+    std::vector<FaultScanSolverOutput<sym>> run_fault_scan(YBus<sym> const& y_bus, ComplexVector const& u_source,
+                                                           IdxVector const& buses = {}) {
+        ComplexValueVector<sym> u_pre_fault(n_bus_);
+        IdxVector const& bus_entry = y_bus.lu_diag();
+
+        detail::copy_y_bus<sym>(y_bus, mat_data_);
+        for (auto const& [bus_number, sources] : enumerated_zip_sequence(*sources_per_bus_)) {
+            detail::add_sources<sym>(sources, bus_number, y_bus, u_source, mat_data_[bus_entry[bus_number]],
+                                     u_pre_fault[bus_number]);
+        }
+        sparse_solver_.prefactorize_and_solve(mat_data_, perm_, u_pre_fault, u_pre_fault);
+        sparse_solver_.invert_selected(mat_data_, perm_, z_bus_);
+
+        auto const scan_bus = [&](Idx bus_number) {
+            FaultScanSolverOutput<sym> result;
+            result.u_pre_fault = u_pre_fault[bus_number];
+            result.z_thevenin = z_bus_[bus_entry[bus_number]];
+            if constexpr (is_symmetric_v<sym>) {
+                result.i_fault_three_phase = result.u_pre_fault / result.z_thevenin;
+                result.i_fault_single_phase = DoubleComplex{nan, nan};
+            } else {
+                result.i_fault_three_phase = dot(inv(result.z_thevenin), result.u_pre_fault);
+                result.i_fault_single_phase = result.u_pre_fault / result.z_thevenin.matrix().diagonal().array();
+            }
+            return result;
+        };
+
+        std::vector<FaultScanSolverOutput<sym>> output;
+        if (buses.empty()) {
+            output.reserve(n_bus_);
+            for (Idx bus_number = 0; bus_number != n_bus_; ++bus_number) {
+                output.push_back(scan_bus(bus_number));
+            }
+        } else {
+            output.reserve(buses.size());
+            std::ranges::transform(buses, std::back_inserter(output), scan_bus);
+        }
         return output;
     }
 
@@ -67,6 +119,8 @@ template <symmetry_tag sym> class ShortCircuitSolver {
     std::shared_ptr<DenseGroupedIdxVector const> sources_per_bus_;
     // sparse linear equation
     ComplexTensorVector<sym> mat_data_;
+    // selected inverse of the factorized matrix, for fault scan
+    ComplexTensorVector<sym> z_bus_;
     // sparse solver
     SparseLUSolver<ComplexTensor<sym>, ComplexValue<sym>, ComplexValue<sym>> sparse_solver_;
     BlockPermArray perm_;
@@ -314,8 +368,10 @@ template <symmetry_tag sym> class ShortCircuitSolver {
                         i_fault += static_cast<ComplexValue<sym>>(i_source_bus / infinite_admittance_fault_counter_bus);
                     }
                     if constexpr (!is_symmetric_v<sym>) {
+                        // the mutual source admittance of the grounded phases is already in the solution
+                        //    only the raw source injection remains, as for the two phase fault
                         if (fault_type == single_phase_to_ground) {
-                            i_fault(phase_1) += i_source_bus[phase_1] / infinite_admittance_fault_counter_bus;
+                            i_fault(phase_1) += i_source_inject[phase_1] / infinite_admittance_fault_counter_bus;
                         } else if (fault_type == two_phase) {
                             i_fault(phase_1) += i_source_inject[phase_1] / infinite_admittance_fault_counter_bus;
                             // i_inj_1 + i_inj_2 = i_ref_1 + i_ref_2
@@ -326,8 +382,8 @@ template <symmetry_tag sym> class ShortCircuitSolver {
                             //           = i_inj_1 - i_ref_1 = i_fault_2_p - i_ref_1
                             i_fault(phase_2) -= i_source_inject[phase_1] / infinite_admittance_fault_counter_bus;
                         } else if (fault_type == two_phase_to_ground) {
-                            i_fault(phase_1) += i_source_bus[phase_1];
-                            i_fault(phase_2) += i_source_bus[phase_2];
+                            i_fault(phase_1) += i_source_inject[phase_1];
+                            i_fault(phase_2) += i_source_inject[phase_2];
                         } else {
                             assert((fault_type == three_phase));
                             continue;
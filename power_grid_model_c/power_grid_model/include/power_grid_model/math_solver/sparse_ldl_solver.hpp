@@ -0,0 +1,242 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "sparse_lu_solver.hpp"
+
+#include "../common/common.hpp"
+#include "../common/exception.hpp"
+#include "../common/three_phase_tensor.hpp"
+#include "../common/typing.hpp"
+
+#include <memory>
+
+namespace power_grid_model::math_solver {
+
+// Sparse block LDL^H solver for hermitian (or real symmetric) matrices
+//
+// The matrix is factorized as A = U^H * D * U
+//    U is block upper triangular with identity blocks on the diagonal
+//    D is block diagonal, each diagonal block is factorized by the dense LU with full pivoting
+// Because only the diagonal blocks are pivoted, no definiteness is required.
+//    The pivots are the same as the ones of the block LU factorization in SparseLUSolver,
+//    so the LDL^H factorization succeeds whenever the LU factorization without pivot perturbation succeeds.
+//
+// Only the diagonal and the upper triangle of the matrix are read and written.
+//    By symmetry, the upper triangle in row-major order is the lower triangle in column-major order.
+// The CSR structure should have a symmetric sparsity pattern including fill-ins.
+// The diagonal entry diag[row] should be the first entry of the upper triangle in each row.
+//    Entries before the diagonal (if any) are never touched.
+//    Therefore the solver can work on both a full LU structure or a compact upper triangular structure.
+template <class Tensor, class RHSVector, class XVector> class SparseLDLSolver {
+  public:
+    using entry_trait = sparse_lu_entry_trait<Tensor, RHSVector, XVector>;
+    static constexpr bool is_block = entry_trait::is_block;
+    static constexpr Idx block_size = entry_trait::block_size;
+    using Scalar = typename entry_trait::Scalar;
+    using LUFactor = typename entry_trait::LUFactor;
+    using BlockPerm = typename entry_trait::BlockPerm;
+    using BlockPermArray = typename entry_trait::BlockPermArray;
+
+    SparseLDLSolver(std::shared_ptr<IdxVector const> const& row_indptr, // indptr including fill-ins
+                    std::shared_ptr<IdxVector const> col_indices,       // indices including fill-ins
+                    std::shared_ptr<IdxVector const> diag)              // position of diagonal entries
+        : size_{static_cast<Idx>(row_indptr->size()) - 1},
+          row_indptr_{row_indptr},
+          col_indices_{std::move(col_indices)},
+          diag_{std::move(diag)} {
+        // pre-allocate buffer for the scaled pivot row
+        Idx max_row_length{};
+        for (Idx row = 0; row != size_; ++row) {
+            max_row_length = std::max(max_row_length, (*row_indptr_)[row + 1] - (*diag_)[row]);
+        }
+        pivot_row_buffer_.resize(max_row_length);
+    }
+
+    // solve with new matrix data, need to factorize first
+    void
+    prefactorize_and_solve(std::vector<Tensor>& data,        // matrix data, factorize in-place
+                           BlockPermArray& block_perm_array, // pre-allocated permutation array, will be overwritten
+                           std::vector<RHSVector> const& rhs, std::vector<XVector>& x) {
+        prefactorize(data, block_perm_array);
+        // call solve with const method
+        solve_with_prefactorized_matrix((std::vector<Tensor> const&)data, block_perm_array, rhs, x);
+    }
+
+    // solve with existing pre-factorization
+    // x and rhs can be the same vector
+    void
+    solve_with_prefactorized_matrix(std::vector<Tensor> const& data,        // pre-factorized data, const ref
+                                    BlockPermArray const& block_perm_array, // pre-calculated permutation, const ref
+                                    std::vector<RHSVector> const& rhs, std::vector<XVector>& x) const {
+        // local reference
+        auto const& row_indptr = *row_indptr_;
+        auto const& col_indices = *col_indices_;
+        auto const& diag = *diag_;
+
+        for (Idx row = 0; row != size_; ++row) {
+            x[row] = rhs[row];
+        }
+
+        // forward substitution with U^H
+        //    because U is stored row-wise, scatter the solved entry to the rows below
+        for (Idx row = 0; row != size_; ++row) {
+            for (Idx u_idx = diag[row] + 1; u_idx < row_indptr[row + 1]; ++u_idx) {
+                x[col_indices[u_idx]] -= dot(hermitian_transpose(data[u_idx]), x[row]);
+            }
+        }
+
+        // solve the diagonal pivots
+        for (Idx row = 0; row != size_; ++row) {
+            if constexpr (is_block) {
+                solve_pivot_in_place(data[diag[row]], block_perm_array[row], x[row]);
+            } else {
+                x[row] = x[row] / data[diag[row]];
+            }
+        }
+
+        // backward substitution with U
+        for (Idx row = size_ - 1; row != -1; --row) {
+            for (Idx u_idx = diag[row] + 1; u_idx < row_indptr[row + 1]; ++u_idx) {
+                x[row] -= dot(data[u_idx], x[col_indices[u_idx]]);
+            }
+        }
+    }
+
+    // prefactorize in-place
+    // the diagonal entries are replaced by the in-place dense LU factorization of D
+    // the upper triangle entries are replaced by U
+    // fill-ins should be pre-allocated with zero
+    // block permutation array should be pre-allocated
+    void prefactorize(std::vector<Tensor>& data, BlockPermArray& block_perm_array) {
+        // local reference
+        auto const& row_indptr = *row_indptr_;
+        auto const& col_indices = *col_indices_;
+        auto const& diag = *diag_;
+
+        for (Idx pivot_row_col = 0; pivot_row_col != size_; ++pivot_row_col) {
+            Idx const pivot_idx = diag[pivot_row_col];
+            Idx const row_end = row_indptr[pivot_row_col + 1];
+
+            // Dense LU factorize pivot for block matrix in-place
+            // D_pivot becomes P_pivot^-1 * L_pivot * U_pivot * Q_pivot^-1
+            if constexpr (is_block) {
+                bool has_pivot_perturbation{false};
+                LUFactor::factorize_block_in_place(data[pivot_idx].matrix(), block_perm_array[pivot_row_col], 0.0,
+                                                   false, has_pivot_perturbation);
+            } else if (!is_normal(data[pivot_idx])) {
+                throw SparseMatrixError{};
+            }
+            Tensor const& pivot = data[pivot_idx];
+
+            // calculate the partially scaled pivot row into the buffer, in the same way as SparseLUSolver
+            // L_pivot * U'_pivot,k = P_pivot * A_pivot,k       k > pivot
+            // for scalar matrix, U'_pivot,k = A_pivot,k
+            for (Idx u_idx = pivot_idx + 1; u_idx < row_end; ++u_idx) {
+                Tensor& u = pivot_row_buffer_[u_idx - pivot_idx];
+                u = data[u_idx];
+                if constexpr (is_block) {
+                    forward_solve_pivot_in_place(pivot, block_perm_array[pivot_row_col], u);
+                }
+            }
+
+            // update the upper triangle of the trailing matrix, the lower triangle follows by symmetry
+            //    A_i,j = A_i,j - L_i,pivot * U'_pivot,j       j >= i > pivot
+            //    L_i,pivot * U_pivot = A_pivot,i^H * Q_pivot
+            // the order of operations is the same as in SparseLUSolver, so the rounding follows the LU factorization
+            //    this matters for ill-conditioned matrices, e.g. the gain matrix of the state estimation
+            // it can create fill-ins, but the fill-ins are pre-allocated
+            // it is guaranteed to have an entry at (i, j), if (pivot, i) and (pivot, j) are non-zero
+            for (Idx l_ref_idx = pivot_idx + 1; l_ref_idx < row_end; ++l_ref_idx) {
+                Idx const l_row = col_indices[l_ref_idx];
+                Tensor const l_conj = [&]() -> Tensor {
+                    if constexpr (is_block) {
+                        Tensor l{hermitian_transpose(data[l_ref_idx])};
+                        l = (l.matrix() * block_perm_array[pivot_row_col].q).array();
+                        for (Idx block_col = 0; block_col < block_size; ++block_col) {
+                            for (Idx block_row = 0; block_row < block_col; ++block_row) {
+                                l.col(block_col) -= pivot(block_row, block_col) * l.col(block_row);
+                            }
+                            l.col(block_col) = l.col(block_col) / pivot(block_col, block_col);
+                        }
+                        return l;
+                    } else {
+                        return hermitian_transpose(data[l_ref_idx]) / pivot;
+                    }
+                }();
+                // starting A index from the diagonal (l_row, l_row)
+                Idx a_idx = diag[l_row];
+                for (Idx u_idx = l_ref_idx; u_idx < row_end; ++u_idx) {
+                    Idx const u_col = col_indices[u_idx];
+                    // search the a_idx to the u_col
+                    auto const found = std::lower_bound(col_indices.cbegin() + a_idx,
+                                                        col_indices.cbegin() + row_indptr[l_row + 1], u_col);
+                    // should always found
+                    assert(found != col_indices.cbegin() + row_indptr[l_row + 1]);
+                    assert(*found == u_col);
+                    a_idx = narrow_cast<Idx>(std::distance(col_indices.cbegin(), found));
+                    // subtract
+                    data[a_idx] -= dot(l_conj, pivot_row_buffer_[u_idx - pivot_idx]);
+                }
+            }
+
+            // store the scaled pivot row
+            // U_pivot,k = Q_pivot * U_pivot^-1 * U'_pivot,k = D_pivot^-1 * A_pivot,k
+            for (Idx u_idx = pivot_idx + 1; u_idx < row_end; ++u_idx) {
+                Tensor& u = data[u_idx];
+                u = pivot_row_buffer_[u_idx - pivot_idx];
+                if constexpr (is_block) {
+                    backward_solve_pivot_in_place(pivot, block_perm_array[pivot_row_col], u);
+                } else {
+                    u = u / pivot;
+                }
+            }
+        }
+    }
+
+  private:
+    Idx size_;
+    std::shared_ptr<IdxVector const> row_indptr_;
+    std::shared_ptr<IdxVector const> col_indices_;
+    std::shared_ptr<IdxVector const> diag_;
+    // buffer of the partially scaled pivot row, position 0 is unused (diagonal)
+    std::vector<Tensor> pivot_row_buffer_;
+
+    // x = D_pivot^-1 * x, where D_pivot is factorized in-place as P^-1 * L * U * Q^-1
+    // x can be a vector or a block matrix
+    template <class Derived>
+    static void solve_pivot_in_place(Tensor const& pivot, BlockPerm const& block_perm,
+                                     Eigen::ArrayBase<Derived>& x) {
+        forward_solve_pivot_in_place(pivot, block_perm, x);
+        backward_solve_pivot_in_place(pivot, block_perm, x);
+    }
+
+    // x = L^-1 * P * x, row by row
+    template <class Derived>
+    static void forward_solve_pivot_in_place(Tensor const& pivot, BlockPerm const& block_perm,
+                                             Eigen::ArrayBase<Derived>& x) {
+        x = (block_perm.p * x.matrix()).array();
+        for (Idx block_row = 0; block_row < block_size; ++block_row) {
+            for (Idx block_col = 0; block_col < block_row; ++block_col) {
+                x.row(block_row) -= pivot(block_row, block_col) * x.row(block_col);
+            }
+        }
+    }
+
+    // x = Q * U^-1 * x, row by row
+    template <class Derived>
+    static void backward_solve_pivot_in_place(Tensor const& pivot, BlockPerm const& block_perm,
+                                              Eigen::ArrayBase<Derived>& x) {
+        for (Idx block_row = block_size - 1; block_row != -1; --block_row) {
+            for (Idx block_col = block_size - 1; block_col > block_row; --block_col) {
+                x.row(block_row) -= pivot(block_row, block_col) * x.row(block_col);
+            }
+            x.row(block_row) = x.row(block_row) / pivot(block_row, block_row);
+        }
+        x = (block_perm.q * x.matrix()).array();
+    }
+};
+
+} // namespace power_grid_model::math_solver
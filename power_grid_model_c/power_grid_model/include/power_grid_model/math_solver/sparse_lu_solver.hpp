@@ -404,6 +404,119 @@ template <class Tensor, class RHSVector, class XVector> class SparseLUSolver {
         }
     }
 
+    // selected inversion with existing pre-factorization
+    // calculate the entries of A^-1 at all the positions of the LU structure (including fill-ins)
+    //    this always includes the diagonal blocks of A^-1
+    // the inverse is written in the same layout as data
+    //
+    // the factorization can be written as P * A * Q = (I + N) * D * (I + M)
+    //    N_k,i = L_k,i * L_i^-1, M_i,k = U_i^-1 * U_i,k, D_i = L_i * U_i, where L_i and U_i are the pivot factors
+    // Z = (P * A * Q)^-1 is calculated backwards with the Takahashi equations
+    //    Z_i,j = - sum_k M_i,k * Z_k,j       j > i, k > i
+    //    Z_j,i = - sum_k Z_j,k * N_k,i       j > i, k > i
+    //    Z_i,i = D_i^-1 - sum_k M_i,k * Z_k,i     k > i
+    // all the Z_k,j needed are in the structure, because the structure is closed under elimination
+    // the inverse is restored from the permutation as (A^-1)_i,j = Q_i * Z_i,j * P_j
+    //
+    // NOTE: if pivot perturbation happened, this is the inverse of the perturbed matrix
+    void invert_selected(std::vector<Tensor> const& data,        // pre-factorized data, const ref
+                         BlockPermArray const& block_perm_array, // pre-calculated permutation, const ref
+                         std::vector<Tensor>& inverse) const {
+        // local reference
+        auto const& row_indptr = *row_indptr_;
+        auto const& col_indices = *col_indices_;
+        auto const& diag_lu = *diag_lu_;
+
+        auto const find_entry = [&row_indptr, &col_indices](Idx row, Idx col) {
+            auto const found = std::lower_bound(col_indices.cbegin() + row_indptr[row],
+                                                col_indices.cbegin() + row_indptr[row + 1], col);
+            // should always found
+            assert(found != col_indices.cbegin() + row_indptr[row + 1]);
+            assert(*found == col);
+            return narrow_cast<Idx>(std::distance(col_indices.cbegin(), found));
+        };
+        auto const zero_tensor = []() -> Tensor {
+            if constexpr (is_block) {
+                return Tensor::Zero();
+            } else {
+                return Tensor{};
+            }
+        };
+
+        inverse.resize(nnz_);
+        // buffer of M_i,k and N_k,i for all k > i in the row
+        Idx max_row_length{};
+        for (Idx row = 0; row != size_; ++row) {
+            max_row_length = std::max(max_row_length, row_indptr[row + 1] - diag_lu[row]);
+        }
+        std::vector<Tensor> m_buffer(max_row_length);
+        std::vector<Tensor> n_buffer(max_row_length);
+
+        for (Idx row = size_ - 1; row != -1; --row) {
+            Idx const pivot_idx = diag_lu[row];
+            Idx const row_end = row_indptr[row + 1];
+            Tensor const& pivot = data[pivot_idx];
+
+            for (Idx u_idx = pivot_idx + 1; u_idx < row_end; ++u_idx) {
+                Idx const l_idx = find_entry(col_indices[u_idx], row);
+                Idx const pos = u_idx - pivot_idx;
+                if constexpr (is_block) {
+                    m_buffer[pos] =
+                        pivot.matrix().template triangularView<Eigen::Upper>().solve(data[u_idx].matrix()).array();
+                    n_buffer[pos] = pivot.matrix()
+                                        .template triangularView<Eigen::UnitLower>()
+                                        .template solve<Eigen::OnTheRight>(data[l_idx].matrix())
+                                        .array();
+                } else {
+                    m_buffer[pos] = data[u_idx] / pivot;
+                    n_buffer[pos] = data[l_idx];
+                }
+            }
+
+            // off-diagonal entries in the row and the column
+            for (Idx u_idx = pivot_idx + 1; u_idx < row_end; ++u_idx) {
+                Idx const col = col_indices[u_idx];
+                Tensor z_upper = zero_tensor();
+                Tensor z_lower = zero_tensor();
+                for (Idx k_idx = pivot_idx + 1; k_idx < row_end; ++k_idx) {
+                    Idx const k = col_indices[k_idx];
+                    z_upper -= dot(m_buffer[k_idx - pivot_idx], inverse[find_entry(k, col)]);
+                    z_lower -= dot(inverse[find_entry(col, k)], n_buffer[k_idx - pivot_idx]);
+                }
+                inverse[u_idx] = z_upper;
+                inverse[find_entry(col, row)] = z_lower;
+            }
+
+            // diagonal entry
+            Tensor z_diag = [&pivot]() -> Tensor {
+                if constexpr (is_block) {
+                    // D_i^-1 = U_i^-1 * L_i^-1
+                    auto d_inv = Eigen::Matrix<Scalar, block_size, block_size>::Identity().eval();
+                    pivot.matrix().template triangularView<Eigen::UnitLower>().solveInPlace(d_inv);
+                    pivot.matrix().template triangularView<Eigen::Upper>().solveInPlace(d_inv);
+                    return d_inv.array();
+                } else {
+                    return 1.0 / pivot;
+                }
+            }();
+            for (Idx u_idx = pivot_idx + 1; u_idx < row_end; ++u_idx) {
+                z_diag -= dot(m_buffer[u_idx - pivot_idx], inverse[find_entry(col_indices[u_idx], row)]);
+            }
+            inverse[pivot_idx] = z_diag;
+        }
+
+        // restore permutation for block matrix
+        if constexpr (is_block) {
+            for (Idx row = 0; row != size_; ++row) {
+                for (Idx idx = row_indptr[row]; idx != row_indptr[row + 1]; ++idx) {
+                    inverse[idx] = (block_perm_array[row].q * inverse[idx].matrix() *
+                                    block_perm_array[col_indices[idx]].p)
+                                       .array();
+                }
+            }
+        }
+    }
+
   private:
     Idx size_;
     Idx nnz_; // number of non zeroes (in block)
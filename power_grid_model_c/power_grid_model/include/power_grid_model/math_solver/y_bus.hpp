@@ -9,6 +9,7 @@
 #include "../common/three_phase_tensor.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <numeric>
 #include <ranges>
@@ -96,6 +97,14 @@ struct YBusStructure {
     // for lu_transpose_entry[i] indicates the position i-th element in transposed lu matrix in CSR form
     // for entry in the diagonal lu_transpose_entry[i] = i
     IdxVector lu_transpose_entry;
+    // upper triangular csr structure (including the diagonal) of the LU structure
+    // used for the factorization of hermitian matrices, for which only half of the matrix needs to be stored
+    // the diagonal is the first entry in each row, and the entries of a row are the tail of the same row in LU
+    // i.e. data_ldl[row_indptr_ldl[row] + k] = data_lu[diag_lu[row] + k]
+    IdxVector row_indptr_ldl;
+    IdxVector col_indices_ldl;
+    // diagonal entry of ldl matrices, diag_ldl[row] = row_indptr_ldl[row]
+    IdxVector diag_ldl;
 
     // construct ybus structure
     explicit YBusStructure(MathModelTopology const& topo) {
@@ -271,6 +280,18 @@ struct YBusStructure {
             lu_transpose_entry[entry_1] = entry_2;
             lu_transpose_entry[entry_2] = entry_1;
         }
+
+        // construct upper triangular structure
+        row_indptr_ldl.resize(n_bus + 1);
+        row_indptr_ldl[0] = 0;
+        diag_ldl.resize(n_bus);
+        col_indices_ldl.reserve(nnz_counter_lu);
+        for (Idx row = 0; row != n_bus; ++row) {
+            diag_ldl[row] = row_indptr_ldl[row];
+            col_indices_ldl.insert(col_indices_ldl.end(), col_indices_lu.cbegin() + diag_lu[row],
+                                   col_indices_lu.cbegin() + row_indptr_lu[row + 1]);
+            row_indptr_ldl[row + 1] = static_cast<Idx>(col_indices_ldl.size());
+        }
     }
 };
 
@@ -309,9 +330,14 @@ template <symmetry_tag sym> class YBus {
     MathModelParam<sym> const& math_model_param() const { return *math_model_param_; }
 
     ComplexTensorVector<sym> const& admittance() const { return admittance_; }
+    // unique over all Y buses and changed on each change of the admittance, a copy keeps the version
+    uint64_t admittance_version() const { return admittance_version_; }
     IdxVector const& bus_entry() const { return y_bus_struct_->bus_entry; }
     IdxVector const& lu_diag() const { return y_bus_struct_->diag_lu; }
     IdxVector const& map_lu_y_bus() const { return y_bus_struct_->map_lu_y_bus; }
+    Idx nnz_ldl() const { return row_indptr_ldl().back(); }
+    IdxVector const& row_indptr_ldl() const { return y_bus_struct_->row_indptr_ldl; }
+    IdxVector const& col_indices_ldl() const { return y_bus_struct_->col_indices_ldl; }
 
     // getter of shared ptr
     std::shared_ptr<IdxVector const> shared_indptr() const { return {y_bus_struct_, &y_bus_struct_->row_indptr}; }
@@ -323,6 +349,13 @@ template <symmetry_tag sym> class YBus {
         return {y_bus_struct_, &y_bus_struct_->col_indices_lu};
     }
     std::shared_ptr<IdxVector const> shared_diag_lu() const { return {y_bus_struct_, &y_bus_struct_->diag_lu}; }
+    std::shared_ptr<IdxVector const> shared_indptr_ldl() const {
+        return {y_bus_struct_, &y_bus_struct_->row_indptr_ldl};
+    }
+    std::shared_ptr<IdxVector const> shared_indices_ldl() const {
+        return {y_bus_struct_, &y_bus_struct_->col_indices_ldl};
+    }
+    std::shared_ptr<IdxVector const> shared_diag_ldl() const { return {y_bus_struct_, &y_bus_struct_->diag_ldl}; }
 
     constexpr auto& get_y_bus_structure() const { return y_bus_struct_; }
 
@@ -365,6 +398,7 @@ template <symmetry_tag sym> class YBus {
             map_admittance_param_shunt_.push_back(entry_param_shunt);
         }
 
+        admittance_version_ = next_admittance_version();
         parameters_changed(true);
     }
 
@@ -404,8 +438,8 @@ template <symmetry_tag sym> class YBus {
         auto const& math_param_branch = math_model_param_->branch_param;
 
         // process and update affected entries
-        for (auto const affected_entries = increments_to_entries(math_model_param_incrmt);
-             auto const entry : affected_entries) {
+        auto const affected_entries = increments_to_entries(math_model_param_incrmt);
+        for (auto const entry : affected_entries) {
             // start admittance accumulation with zero
             ComplexTensor<sym> entry_admittance{0.0};
             // loop over all entries of this position
@@ -423,7 +457,11 @@ template <symmetry_tag sym> class YBus {
             admittance_[entry] = entry_admittance;
         }
 
-        parameters_changed(true);
+        // the admittance of a math model without affected entries is unchanged
+        if (!affected_entries.empty()) {
+            admittance_version_ = next_admittance_version();
+        }
+        parameters_changed(!affected_entries.empty());
     }
 
     ComplexValue<sym> calculate_injection(ComplexValueVector<sym> const& u, Idx bus_number) const {
@@ -496,10 +534,10 @@ template <symmetry_tag sym> class YBus {
     /// @param callback the callback to register
     /// @return the unique key referencing this callback (used for unregistering)
     uint64_t register_parameters_changed_callback(ParamChangedCallback callback) {
-        static uint64_t num_added = 0;
+        // the models of a batch calculation register their callbacks in parallel
+        static std::atomic<uint64_t> num_added = 0;
 
-        auto const new_key = num_added;
-        ++num_added;
+        auto const new_key = num_added++;
 
         assert(!parameters_changed_callbacks_.contains(new_key));
         parameters_changed_callbacks_.emplace_hint(parameters_changed_callbacks_.cend(), new_key, std::move(callback));
@@ -513,12 +551,18 @@ template <symmetry_tag sym> class YBus {
         parameters_changed_callbacks_.erase(key);
     }
 
+    /// @brief unregister all callbacks
+    /// @note a copy of a Y bus initially signals the math solvers of the original,
+    ///       the callbacks are cleared to register those of the math solvers of the copy instead
+    void clear_parameters_changed_callbacks() { parameters_changed_callbacks_.clear(); }
+
   private:
     // csr structure
     std::shared_ptr<YBusStructure const> y_bus_struct_;
 
     // admittance
     ComplexTensorVector<sym> admittance_;
+    uint64_t admittance_version_{};
 
     // cache math topology
     std::shared_ptr<MathModelTopology const> math_topology_;
@@ -536,6 +580,11 @@ template <symmetry_tag sym> class YBus {
 
     std::unordered_map<uint64_t, ParamChangedCallback> parameters_changed_callbacks_;
 
+    static uint64_t next_admittance_version() {
+        static std::atomic<uint64_t> version = 0;
+        return ++version;
+    }
+
     void parameters_changed(bool param_changed) const {
         std::ranges::for_each(parameters_changed_callbacks_, [param_changed](auto const& key_and_callback) {
             key_and_callback.second(param_changed);
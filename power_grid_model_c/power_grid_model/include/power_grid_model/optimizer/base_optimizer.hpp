@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include "../auxiliary/dataset.hpp"
 #include "../main_core/state.hpp"
 
 #include <concepts>
+#include <functional>
+#include <optional>
 
 namespace power_grid_model::optimizer {
 
@@ -27,6 +30,13 @@ struct state_calculator_type {
 template <typename StateCalculator, typename State_>
 using state_calculator_result_t = typename state_calculator_type<StateCalculator, State_>::result_type;
 
+// evaluate the calculation for several candidate updates, e.g. on replicas of the state
+// a candidate for which the calculation failed has no result
+template <typename StateCalculator, typename State>
+using candidate_evaluator_t =
+    std::function<std::vector<std::optional<state_calculator_result_t<StateCalculator, State>>>(
+        std::vector<ConstDataset> const&, CalculationMethod)>;
+
 template <typename StateCalculator, typename State>
 concept steady_state_calculator_c =
     steady_state_solver_output_type<typename detail::state_calculator_result_t<StateCalculator, State>::value_type> &&
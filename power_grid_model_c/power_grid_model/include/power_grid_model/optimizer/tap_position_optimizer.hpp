@@ -18,9 +18,13 @@
 #include "../main_core/state_queries.hpp"
 
 #include <boost/graph/compressed_sparse_row_graph.hpp>
+#include <boost/graph/iteration_macros.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
+#include <map>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <queue>
@@ -372,6 +376,27 @@ struct TransformerRanker {
     }
 };
 
+// The ranking of the regulated transformers only depends on the topology and on the statuses of the regulators, so it
+// can be reused by subsequent optimizations as long as the topology does not change.
+struct TransformerRanking {
+    RankedTransformerGroups order;
+    std::vector<uint64_t> max_tap_ranges_per_rank;
+    std::vector<IntS> regulator_status;
+};
+// read-only, so that it can be shared between copies of the same model
+using TransformerRankingCache = std::shared_ptr<TransformerRanking const>;
+
+template <main_core::main_model_state_c State>
+    requires main_core::component_container_c<typename State::ComponentContainer, TransformerTapRegulator>
+inline std::vector<IntS> get_regulator_status(State const& state) {
+    std::vector<IntS> result;
+    result.reserve(state.components.template size<TransformerTapRegulator>());
+    for (auto const& regulator : state.components.template citer<TransformerTapRegulator>()) {
+        result.push_back(static_cast<IntS>(regulator.status()));
+    }
+    return result;
+}
+
 constexpr IntS one_step_tap_up(transformer_c auto const& transformer) {
     IntS const tap_pos = transformer.tap_pos();
     IntS const tap_max = transformer.tap_max();
@@ -654,10 +679,13 @@ template <symmetry_tag sym> struct NodeState {
     ComplexValue<sym> u;
     ComplexValue<sym> i;
 
+    double v_compensated(TransformerTapRegulatorCalcParam const& param) const {
+        auto const u_compensated = u + param.z_compensation * i;
+        return mean_val(cabs(u_compensated)); // TODO(mgovers): handle asym correctly
+    }
+
     friend auto operator<=>(NodeState<sym> const& state, TransformerTapRegulatorCalcParam const& param) {
-        auto const u_compensated = state.u + param.z_compensation * state.i;
-        auto const v_compensated = mean_val(cabs(u_compensated)); // TODO(mgovers): handle asym correctly
-        return v_compensated <=> VoltageBand{.u_set = param.u_set, .u_band = param.u_band};
+        return state.v_compensated(param) <=> VoltageBand{.u_set = param.u_set, .u_band = param.u_band};
     }
 };
 
@@ -714,9 +742,11 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     using typename Base::State;
     using StateUpdater = StateUpdater_;
     using TransformerRanker = TransformerRanker_;
+    using CandidateEvaluator = detail::candidate_evaluator_t<Calculator, State>;
 
   private:
     std::vector<uint64_t> max_tap_ranges_per_rank;
+    TransformerRankingCache* ranking_cache_;
     using ComponentContainer = typename State::ComponentContainer;
     using RegulatedTransformer = TapRegulatorRef<TransformerTypes...>;
     using UpdateBuffer = std::tuple<std::vector<typename TransformerTypes::UpdateType>...>;
@@ -740,6 +770,33 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         constexpr void set_current_tap(IntS current_tap) { current_ = current_tap; }
         constexpr void set_last_check(bool last_check) { last_check_ = last_check; }
         constexpr void set_inevitable_run(bool inevitable_run) { inevitable_run_ = inevitable_run; }
+        constexpr void set_current_in_band() { in_band_tap_ = current_; }
+
+        // Restrict the search to the tap positions around the current one, which is expected to be close to the
+        // result, e.g. because it is the result of a previous calculation.
+        void narrow(IntS radius) {
+            lower_bound_ = static_cast<IntS>(std::max<int>(tap_lower_bound_, current_ - radius));
+            upper_bound_ = static_cast<IntS>(std::min<int>(tap_upper_bound_, current_ + radius));
+            narrowed_ = true;
+        }
+
+        // Restore the full tap range if the search ended at a bound of the narrowed range that is not a bound of the
+        // full tap range without a voltage in the band, because the result may then be outside of the narrowed range.
+        bool widen_if_exhausted() {
+            if (!narrowed_) {
+                return false;
+            }
+            narrowed_ = false;
+            if (in_band_tap_ != current_ && ((current_ == lower_bound_ && lower_bound_ != tap_lower_bound_) ||
+                                             (current_ == upper_bound_ && upper_bound_ != tap_upper_bound_))) {
+                lower_bound_ = tap_lower_bound_;
+                upper_bound_ = tap_upper_bound_;
+                last_check_ = false;
+                inevitable_run_ = false;
+                return true;
+            }
+            return false;
+        }
 
         void recalibrate(bool strategy_max) {
             // This if statement checks both conditions in the corresponding transformer
@@ -801,6 +858,10 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
             inevitable_run_ = false;
             lower_bound_ = std::min(tap_min, tap_max);
             upper_bound_ = std::max(tap_min, tap_max);
+            tap_lower_bound_ = lower_bound_;
+            tap_upper_bound_ = upper_bound_;
+            narrowed_ = false;
+            in_band_tap_ = std::nullopt;
             tap_reverse_ = tap_max < tap_min;
             control_at_tap_side_ = control_at_tap_side;
         }
@@ -833,36 +894,97 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
 
         IntS lower_bound_{};              // tap position lower bound
         IntS upper_bound_{};              // tap position upper bound
+        IntS tap_lower_bound_{};          // lower bound of the full tap range
+        IntS tap_upper_bound_{};          // upper bound of the full tap range
         IntS current_{0};                 // current tap position
         bool last_down_{false};           // last direction
         bool last_check_{false};          // last run checked
         bool tap_reverse_{false};         // tap range normal or reversed
         bool inevitable_run_{false};      // inevitable run
         bool control_at_tap_side_{false}; // regulator control side is at tap side
+        bool narrowed_{false};            // search is restricted to a part of the tap range
+        std::optional<IntS> in_band_tap_; // last tap position for which the voltage was in the band
     };
     std::vector<std::vector<BinarySearch>> binary_search_;
+
+    class SensitivitySearch {
+      public:
+        SensitivitySearch() = default;
+        SensitivitySearch(IntS tap_min, IntS tap_max)
+            : lower_bound_{std::min(tap_min, tap_max)}, upper_bound_{std::max(tap_min, tap_max)} {}
+
+        // Propose the tap position at which the compensated voltage is predicted to reach u_set.
+        // The voltage-to-tap sensitivity is the secant through the last two evaluated operating points,
+        // so that it includes the effect of the grid impedances at the current operating point.
+        // Fall back to the one step proposal if there is no usable sensitivity yet, or if the prediction
+        // does not go in the same direction as the one step proposal.
+        IntS propose_tap(IntS tap_pos, double voltage, double u_set, IntS one_step_tap) {
+            IntS result = one_step_tap;
+            if (has_last_ && last_tap_ != tap_pos) {
+                double const sensitivity = (voltage - last_voltage_) / static_cast<double>(tap_pos - last_tap_);
+                if (std::isnormal(sensitivity)) {
+                    double const predicted = std::round(static_cast<double>(tap_pos) + (u_set - voltage) / sensitivity);
+                    auto const predicted_tap = static_cast<IntS>(
+                        std::clamp(predicted, static_cast<double>(lower_bound_), static_cast<double>(upper_bound_)));
+                    if ((predicted_tap - tap_pos) * (one_step_tap - tap_pos) > 0) {
+                        result = predicted_tap;
+                    }
+                }
+            }
+            last_tap_ = tap_pos;
+            last_voltage_ = voltage;
+            has_last_ = true;
+            return result;
+        }
+
+      private:
+        IntS lower_bound_{};    // tap position lower bound
+        IntS upper_bound_{};    // tap position upper bound
+        IntS last_tap_{};       // tap position of the last evaluated operating point
+        double last_voltage_{}; // compensated voltage of the last evaluated operating point
+        bool has_last_{false};  // whether there is a last evaluated operating point
+    };
+    std::vector<std::vector<SensitivitySearch>> sensitivity_search_;
+
     struct BinarySearchOptions {
         bool strategy_max{false};
         Idx2D idx_bs{.group = 0, .pos = 0};
     };
     Idx total_iterations{0}; // metric purpose only
 
+    // results of speculatively evaluated tap positions of all regulated transformers, in regulator order
+    std::map<std::vector<IntS>, ResultType> speculative_results_;
+
+    // tap positions to start the search from, e.g. the result of a previous calculation, by transformer ID
+    std::map<ID, IntS> initial_tap_positions_;
+    // half width of the binary search range around an initial tap position
+    static constexpr IntS initial_tap_search_radius{2};
+
   public:
     TapPositionOptimizerImpl(Calculator calculator, StateUpdater updater, OptimizerStrategy strategy,
                              meta_data::MetaData const& meta_data,
-                             std::optional<SearchMethod> tap_search = std::nullopt)
-        : meta_data_{&meta_data}, calculate_{std::move(calculator)}, update_{std::move(updater)}, strategy_{strategy} {
+                             std::optional<SearchMethod> tap_search = std::nullopt,
+                             CandidateEvaluator evaluate_candidates = {},
+                             TransformerTapPositionOutput const& initial_tap_positions = {},
+                             TransformerRankingCache* ranking_cache = nullptr)
+        : ranking_cache_{ranking_cache},
+          meta_data_{&meta_data},
+          calculate_{std::move(calculator)},
+          update_{std::move(updater)},
+          evaluate_candidates_{std::move(evaluate_candidates)},
+          strategy_{strategy} {
         auto const is_supported = [&strategy](std::optional<SearchMethod> const& search) {
             if (!search) {
                 return true;
             }
             switch (strategy) {
             case OptimizerStrategy::any:
-                return search == SearchMethod::linear_search;
+                return search == SearchMethod::linear_search || search == SearchMethod::sensitivity_search;
             case OptimizerStrategy::fast_any:
-                return search == SearchMethod::binary_search;
+                return search == SearchMethod::binary_search || search == SearchMethod::sensitivity_search;
             default:
-                return true;
+                // the sensitivity search finds any tap position in the band, not the optimal one
+                return search != SearchMethod::sensitivity_search;
             }
         };
 
@@ -889,17 +1011,25 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         } else {
             tap_search_ = tap_search.value();
         }
+
+        for (auto const& [transformer_id, tap_position] : initial_tap_positions) {
+            initial_tap_positions_.emplace(transformer_id, tap_position);
+        }
     }
 
     auto optimize(State const& state, CalculationMethod method) -> MathOutput<ResultType> final {
-        auto const order = regulator_mapping<TransformerTypes...>(state, TransformerRanker{}(state));
+        auto const ranking = get_ranking(state);
+        auto const order = regulator_mapping<TransformerTypes...>(state, ranking->order);
+        max_tap_ranges_per_rank = ranking->max_tap_ranges_per_rank;
         auto const cache = cache_states(order);
         try {
             opt_prep(order);
             auto result = optimize(state, order, method);
+            speculative_results_.clear();
             update_state(cache);
             return result;
         } catch (...) {
+            speculative_results_.clear();
             update_state(cache);
             throw;
         }
@@ -909,22 +1039,45 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     Idx get_total_iterations() const { return total_iterations; }
 
   private:
-    void opt_prep(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
+    // the ranking from the cache if it is still valid, otherwise a new ranking, which is then stored in the cache
+    TransformerRankingCache get_ranking(State const& state) const {
+        auto regulator_status = get_regulator_status(state);
+        if (ranking_cache_ != nullptr && *ranking_cache_ != nullptr &&
+            (*ranking_cache_)->regulator_status == regulator_status) {
+            return *ranking_cache_;
+        }
+
+        auto order = TransformerRanker{}(state);
+        auto max_tap_ranges = get_max_tap_ranges_per_rank(regulator_mapping<TransformerTypes...>(state, order));
+        auto result = std::make_shared<TransformerRanking const>(
+            TransformerRanking{.order = std::move(order),
+                               .max_tap_ranges_per_rank = std::move(max_tap_ranges),
+                               .regulator_status = std::move(regulator_status)});
+        if (ranking_cache_ != nullptr) {
+            *ranking_cache_ = result;
+        }
+        return result;
+    }
+
+    static std::vector<uint64_t>
+    get_max_tap_ranges_per_rank(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
         constexpr auto tap_pos_range_cmp = [](RegulatedTransformer const& a, RegulatedTransformer const& b) {
             return a.transformer.tap_range() < b.transformer.tap_range();
         };
 
-        bs_prep(regulator_order);
-
-        if (max_tap_ranges_per_rank.empty()) {
-            max_tap_ranges_per_rank.reserve(regulator_order.size());
-            for (auto const& same_rank_regulators : regulator_order) {
-                max_tap_ranges_per_rank.push_back(std::ranges::max_element(same_rank_regulators.begin(),
-                                                                           same_rank_regulators.end(),
-                                                                           tap_pos_range_cmp)
-                                                      ->transformer.tap_range());
-            }
+        std::vector<uint64_t> result;
+        result.reserve(regulator_order.size());
+        for (auto const& same_rank_regulators : regulator_order) {
+            result.push_back(
+                std::ranges::max_element(same_rank_regulators.begin(), same_rank_regulators.end(), tap_pos_range_cmp)
+                    ->transformer.tap_range());
         }
+        return result;
+    }
+
+    void opt_prep(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
+        bs_prep(regulator_order);
+        sensitivity_prep(regulator_order);
 
         total_iterations = 0;
     }
@@ -945,12 +1098,31 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         }
     }
 
+    void sensitivity_prep(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
+        sensitivity_search_.clear();
+        if (tap_search_ != SearchMethod::sensitivity_search) {
+            return;
+        }
+
+        sensitivity_search_.reserve(regulator_order.size());
+        for (auto const& same_rank_regulators : regulator_order) {
+            std::vector<SensitivitySearch> sensitivity_search_group(same_rank_regulators.size());
+            std::ranges::transform(same_rank_regulators, sensitivity_search_group.begin(), [](auto const& regulator) {
+                return SensitivitySearch{regulator.transformer.tap_min(), regulator.transformer.tap_max()};
+            });
+            sensitivity_search_.push_back(std::move(sensitivity_search_group));
+        }
+    }
+
     auto optimize(State const& state, std::vector<std::vector<RegulatedTransformer>> const& regulator_order,
                   CalculationMethod method) -> MathOutput<ResultType> {
         pilot_run(regulator_order);
 
         if (auto result = iterate_with_fallback(state, regulator_order, method, tap_search_);
             strategy_ == OptimizerStrategy::any || strategy_ == OptimizerStrategy::fast_any) {
+            if (widen_binary_search()) {
+                result = iterate_with_fallback(state, regulator_order, method, tap_search_);
+            }
             return produce_output(regulator_order, std::move(result));
         }
 
@@ -994,6 +1166,7 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
 
     auto iterate(State const& state, std::vector<std::vector<RegulatedTransformer>> const& regulator_order,
                  CalculationMethod method, SearchMethod search) -> ResultType {
+        speculative_results_.clear();
         auto result = calculate_(state, method);
         ++total_iterations;
 
@@ -1006,13 +1179,17 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         while (tap_changed) {
             tap_changed = false;
             UpdateBuffer update_data;
+            std::vector<Idx2D> changed_regulators;
             rank_iterator.set_rank_index(0);
 
             auto const adjust_transformer_in_rank = [&](Idx const& rank_idx, Idx const& transformer_idx,
                                                         std::vector<RegulatedTransformer> const& same_rank_regulators) {
                 auto const& regulator = same_rank_regulators[transformer_idx];
                 BinarySearchOptions const options{strategy_max, Idx2D{.group = rank_idx, .pos = transformer_idx}};
-                tap_changed = adjust_transformer(regulator, state, result, update_data, search, options) || tap_changed;
+                if (adjust_transformer(regulator, state, result, update_data, search, options)) {
+                    changed_regulators.push_back(options.idx_bs);
+                    tap_changed = true;
+                }
                 return tap_changed;
             };
 
@@ -1025,13 +1202,112 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
                     throw MaxIterationReached{"TapPositionOptimizer::iterate"};
                 }
                 update_state(update_data);
-                result = calculate_(state, method);
+                result = calculate_speculatively(
+                    state, regulator_order, method,
+                    speculative_tap_positions(regulator_order, changed_regulators, search, strategy_max));
                 ++total_iterations;
             }
         }
         return result;
     }
 
+    static auto current_tap_positions(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
+        std::vector<IntS> result;
+        for (auto const& sub_order : regulator_order) {
+            for (auto const& regulator : sub_order) {
+                result.push_back(regulator.transformer.tap_pos());
+            }
+        }
+        return result;
+    }
+
+    // The tap positions that the binary search will propose in the next round, for both outcomes of the comparison
+    // with the voltage band. Only applicable if a single regulator was adjusted in the last round, because otherwise
+    // the number of combinations grows exponentially.
+    auto speculative_tap_positions(std::vector<std::vector<RegulatedTransformer>> const& regulator_order,
+                                   std::vector<Idx2D> const& changed_regulators, SearchMethod search,
+                                   bool strategy_max) const -> std::vector<std::vector<IntS>> {
+        if (!evaluate_candidates_ || search != SearchMethod::binary_search || changed_regulators.size() != 1) {
+            return {};
+        }
+
+        auto const [rank_idx, transformer_idx] = changed_regulators.front();
+        auto const& current_bs = binary_search_[rank_idx][transformer_idx];
+        if (current_bs.get_end_of_bs() || current_bs.get_inevitable_run()) {
+            return {};
+        }
+
+        auto const current_taps = current_tap_positions(regulator_order);
+        auto const flat_idx = std::transform_reduce(
+            regulator_order.begin(), regulator_order.begin() + rank_idx, transformer_idx, std::plus{},
+            [](auto const& same_rank_regulators) { return static_cast<Idx>(same_rank_regulators.size()); });
+
+        std::vector<std::vector<IntS>> result;
+        for (bool const above_range : {true, false}) {
+            auto next_bs = current_bs;
+            next_bs.propose_new_pos(strategy_max, above_range);
+            if (next_bs.get_current_tap() != current_taps[flat_idx]) {
+                auto& candidate = result.emplace_back(current_taps);
+                candidate[flat_idx] = next_bs.get_current_tap();
+            }
+        }
+        return result;
+    }
+
+    // Calculate the current state. If a candidate evaluator is provided, the speculative tap positions are evaluated
+    // concurrently with the current one and cached, so that the next round can reuse the result if it proposes one of
+    // them. A candidate that failed is calculated again on the current state, so that errors are reported as usual.
+    auto calculate_speculatively(State const& state,
+                                 std::vector<std::vector<RegulatedTransformer>> const& regulator_order,
+                                 CalculationMethod method, std::vector<std::vector<IntS>> speculative_taps)
+        -> ResultType {
+        auto current_taps = current_tap_positions(regulator_order);
+        if (auto const it = speculative_results_.find(current_taps); it != speculative_results_.end()) {
+            auto result = std::move(it->second);
+            speculative_results_.clear();
+            return result;
+        }
+        speculative_results_.clear();
+
+        if (speculative_taps.empty()) {
+            return calculate_(state, method);
+        }
+
+        auto candidates = std::move(speculative_taps);
+        candidates.insert(candidates.begin(), std::move(current_taps));
+
+        std::vector<UpdateBuffer> update_buffers(candidates.size());
+        for (Idx idx = 0; idx < static_cast<Idx>(candidates.size()); ++idx) {
+            auto tap_it = candidates[idx].cbegin();
+            for (auto const& sub_order : regulator_order) {
+                for (auto const& regulator : sub_order) {
+                    IntS const tap_pos = *tap_it++;
+                    regulator.transformer.apply(
+                        [tap_pos, &update_buffer = update_buffers[idx]](transformer_c auto const& transformer) {
+                            add_tap_pos_update(tap_pos, transformer, update_buffer);
+                        });
+                }
+            }
+        }
+        std::vector<ConstDataset> update_datasets;
+        update_datasets.reserve(update_buffers.size());
+        for (auto const& update_buffer : update_buffers) {
+            update_datasets.push_back(make_update_dataset(update_buffer));
+        }
+
+        auto results = evaluate_candidates_(update_datasets, method);
+        assert(results.size() == candidates.size());
+        for (Idx idx = 1; idx < static_cast<Idx>(candidates.size()); ++idx) {
+            if (results[idx]) {
+                speculative_results_.emplace(std::move(candidates[idx]), std::move(*results[idx]));
+            }
+        }
+        if (results.front()) {
+            return std::move(*results.front());
+        }
+        return calculate_(state, method);
+    }
+
     bool adjust_transformer(RegulatedTransformer const& regulator, State const& state, ResultType const& solver_output,
                             UpdateBuffer& update_data, SearchMethod search, BinarySearchOptions const& options) {
         switch (search) {
@@ -1039,6 +1315,8 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
             return adjust_transformer_bs(regulator, state, solver_output, update_data, options);
         case SearchMethod::linear_search:
             return adjust_transformer_scan(regulator, state, solver_output, update_data);
+        case SearchMethod::sensitivity_search:
+            return adjust_transformer_sensitivity(regulator, state, solver_output, update_data, options);
         default:
             throw MissingCaseForEnumError{"TapPositionOptimizer::adjust_transformer", search};
         }
@@ -1090,6 +1368,41 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         return tap_changed;
     }
 
+    bool adjust_transformer_sensitivity(RegulatedTransformer const& regulator, State const& state,
+                                        ResultType const& solver_output, UpdateBuffer& update_data,
+                                        BinarySearchOptions const& options) {
+        bool tap_changed = false;
+        auto& current_search = sensitivity_search_[options.idx_bs.group][options.idx_bs.pos];
+
+        regulator.transformer.apply([&](transformer_c auto const& transformer) {
+            using TransformerType = std::remove_cvref_t<decltype(transformer)>;
+            if (!is_regulated_transformer_connected<TransformerType>(regulator, state)) {
+                return;
+            }
+
+            auto [node_state, param] = compute_node_state_and_param<TransformerType>(regulator, state, solver_output);
+
+            bool const control_at_tap_side = regulator.control_at_tap_side();
+
+            auto const cmp = node_state <=> param;
+            if (cmp == 0) { // NOLINT(modernize-use-nullptr)
+                return;
+            }
+            IntS const one_step_tap = cmp > 0 // NOLINT(modernize-use-nullptr)
+                                          ? one_step_control_voltage_down(transformer, control_at_tap_side)
+                                          : one_step_control_voltage_up(transformer, control_at_tap_side);
+            IntS const new_tap_pos = current_search.propose_tap(
+                transformer.tap_pos(), node_state.v_compensated(param), param.u_set, one_step_tap);
+
+            if (new_tap_pos != transformer.tap_pos()) {
+                add_tap_pos_update(new_tap_pos, transformer, update_data);
+                tap_changed = true;
+            }
+        });
+
+        return tap_changed;
+    }
+
     bool adjust_transformer_bs(RegulatedTransformer const& regulator, State const& state,
                                ResultType const& solver_output, UpdateBuffer& update_data,
                                BinarySearchOptions const& options) {
@@ -1111,6 +1424,9 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
             auto [node_state, param] = compute_node_state_and_param<TransformerType>(regulator, state, solver_output);
 
             auto const cmp = node_state <=> param;
+            if (cmp == 0) { // NOLINT(modernize-use-nullptr)
+                current_bs.set_current_in_band();
+            }
             if (auto new_tap_pos =
                     [&cmp, strategy_max, &current_bs] {
                         if (cmp != 0) {                                        // NOLINT(modernize-use-nullptr)
@@ -1141,7 +1457,7 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         return tap_changed;
     }
 
-    void update_state(UpdateBuffer const& update_data) const {
+    ConstDataset make_update_dataset(UpdateBuffer const& update_data) const {
         static_assert(sizeof...(TransformerTypes) == std::tuple_size_v<UpdateBuffer>);
 
         ConstDataset update_dataset{false, 1, "update", *meta_data_};
@@ -1152,8 +1468,11 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
             }
         };
         (update_component.template operator()<TransformerTypes>(), ...);
+        return update_dataset;
+    }
 
-        if (!update_dataset.empty()) {
+    void update_state(UpdateBuffer const& update_data) const {
+        if (auto const update_dataset = make_update_dataset(update_data); !update_dataset.empty()) {
             update_(update_dataset);
         }
     }
@@ -1192,10 +1511,13 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
             return transformer.tap_max();
         };
 
+        bool initial_tap_positions_used = false;
         switch (strategy_) {
         case OptimizerStrategy::fast_any:
             [[fallthrough]];
         case OptimizerStrategy::any:
+            // any tap position in the band is accepted, so the search can start anywhere
+            initial_tap_positions_used = regulate_to_initial_tap_positions(regulator_order);
             break;
         case OptimizerStrategy::global_maximum:
             [[fallthrough]];
@@ -1212,7 +1534,55 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
         }
         if (tap_search_ == SearchMethod::binary_search) {
             update_binary_search(regulator_order);
+            if (initial_tap_positions_used) {
+                narrow_binary_search(regulator_order);
+            }
+        }
+    }
+
+    std::optional<IntS> initial_tap_pos(transformer_c auto const& transformer) const {
+        if (auto const it = initial_tap_positions_.find(transformer.id()); it != initial_tap_positions_.end()) {
+            return std::clamp(it->second, std::min(transformer.tap_min(), transformer.tap_max()),
+                              std::max(transformer.tap_min(), transformer.tap_max()));
+        }
+        return std::nullopt;
+    }
+
+    bool regulate_to_initial_tap_positions(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
+        if (initial_tap_positions_.empty()) {
+            return false;
+        }
+        regulate_transformers(
+            [this](transformer_c auto const& transformer, bool /* control_at_tap_side */) -> IntS {
+                return initial_tap_pos(transformer).value_or(transformer.tap_pos());
+            },
+            regulator_order);
+        return true;
+    }
+
+    void narrow_binary_search(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
+        for (Idx i = 0; i < static_cast<Idx>(regulator_order.size()); ++i) {
+            auto const& sub_order = regulator_order[i];
+            for (Idx j = 0; j < static_cast<Idx>(sub_order.size()); ++j) {
+                sub_order[j].transformer.apply([this, i, j](transformer_c auto const& transformer) {
+                    if (initial_tap_pos(transformer).has_value()) {
+                        binary_search_[i][j].narrow(initial_tap_search_radius);
+                    }
+                });
+            }
+        }
+    }
+
+    // widen the binary searches that were narrowed around the initial tap positions but did not find the result
+    // within the narrowed range
+    bool widen_binary_search() {
+        bool widened = false;
+        for (auto& same_rank_binary_search : binary_search_) {
+            for (auto& bs : same_rank_binary_search) {
+                widened = bs.widen_if_exhausted() || widened;
+            }
         }
+        return widened;
     }
 
     void exploit_neighborhood(std::vector<std::vector<RegulatedTransformer>> const& regulator_order) {
@@ -1330,6 +1700,7 @@ class TapPositionOptimizerImpl<std::tuple<TransformerTypes...>, StateCalculator,
     meta_data::MetaData const* meta_data_;
     Calculator calculate_;
     StateUpdater update_;
+    CandidateEvaluator evaluate_candidates_;
     OptimizerStrategy strategy_;
     SearchMethod tap_search_;
 };
@@ -11,10 +11,13 @@
 #include "index_mapping.hpp"
 #include "sparse_ordering.hpp"
 
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/compressed_sparse_row_graph.hpp>
-#include <boost/graph/depth_first_search.hpp>
-#include <boost/graph/iteration_macros.hpp>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <vector>
 
 // build topology of the grid
 // divide grid into several math models
@@ -24,82 +27,36 @@
 namespace power_grid_model {
 
 class Topology {
-    using GraphIdx = size_t;
+    using GraphIdx = Idx;
 
     struct GlobalEdge {
+        GraphIdx target;
         double phase_shift;
     };
 
-    struct GlobalVertex {
-        boost::default_color_type color;
-    };
-
-    // sparse directed graph
+    // sparse directed graph in compressed sparse row format
+    // the out edges of node i are edges[row_indptr[i]:row_indptr[i + 1]]
     // edge i -> j, the phase shift is node_j - node_i
     // so to move forward from i to j, the phase shift is appended by value at (i, j)
     // for 3-way branch, the internal node is appended at the end one by one
     // n_node + k, k as branch3 sequence number
     // branch3 #0, has internal node idx n_node
     // branch3 #1, has internal node idx n_node + 1
-    using GlobalGraph = boost::compressed_sparse_row_graph<boost::directedS, GlobalVertex, GlobalEdge,
-                                                           boost::no_property, GraphIdx, GraphIdx>;
-
-    // dfs visitor for global graph
-    class GlobalDFSVisitor : public boost::dfs_visitor<> {
-      public:
-        GlobalDFSVisitor(Idx math_group, std::vector<Idx2D>& node_coupling, std::vector<double>& phase_shift,
-                         std::vector<Idx>& dfs_node, std::vector<GraphIdx>& predecessors,
-                         std::vector<std::pair<GraphIdx, GraphIdx>>& back_edges)
-            : math_group_{math_group},
-              node_coupling_{node_coupling},
-              phase_shift_{phase_shift},
-              dfs_node_{dfs_node},
-              predecessors_{predecessors},
-              back_edges_{back_edges} {}
-
-        // accumulate phase shift
-        // assign predecessor
-        void tree_edge(GlobalGraph::edge_descriptor e, GlobalGraph const& g) {
-            GraphIdx const source = boost::source(e, g);
-            GraphIdx const target = boost::target(e, g);
-            phase_shift_[target] = phase_shift_[source] + g[e].phase_shift;
-            predecessors_[target] = source;
-        }
-
-        // forward_or_cross_edge
-        // in symmetric directed graph (equivalent to undirected)
-        //    forward edge is ignored
-        //    cross edge does not exist
-
-        // back edge, judge if it forms a cycle
-        void back_edge(GlobalGraph::edge_descriptor e, GlobalGraph const& g) {
-            GraphIdx const source = boost::source(e, g);
-            GraphIdx const target = boost::target(e, g);
-            // if this edge matches in the current tree as target->source
-            // it does not form a cycle, but an anti-parallel edge
-            // else it forms a cycle
-            if (predecessors_[source] != target) {
-                back_edges_.emplace_back(source, target);
-            }
-        }
-
-        // assign node to math group
-        // append node to dfs list
-        void discover_vertex(GlobalGraph::vertex_descriptor u, GlobalGraph const& /* unused_value */) {
-            node_coupling_[u].group = math_group_;
-            dfs_node_.push_back(static_cast<Idx>(u));
-        }
+    struct GlobalGraph {
+        IdxVector row_indptr;
+        std::vector<GlobalEdge> edges;
+    };
 
-      private:
-        Idx math_group_;
+    // dfs color of a node
+    //    white, not yet discovered
+    //    gray, discovered, but not all out edges are examined
+    //    black, all out edges are examined
+    enum class DFSColor : IntS { white = 0, gray = 1, black = 2 };
 
-        // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
-        std::vector<Idx2D>& node_coupling_;
-        std::vector<double>& phase_shift_;
-        std::vector<Idx>& dfs_node_;
-        std::vector<GraphIdx>& predecessors_;
-        std::vector<std::pair<GraphIdx, GraphIdx>>& back_edges_;
-        // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
+    // dfs stack entry: the node and the next out edge to examine
+    struct DFSStackEntry {
+        GraphIdx node;
+        Idx next_edge;
     };
 
   public:
@@ -107,10 +64,24 @@ class Topology {
         : comp_topo_{comp_topo},
           comp_conn_{comp_conn},
           phase_shift_(comp_topo_.n_node_total(), 0.0),
-          predecessors_(
-              boost::counting_iterator<GraphIdx>{0}, // Predecessors is initialized as 0, 1, 2, ..., n_node_total() - 1
-              boost::counting_iterator<GraphIdx>{(GraphIdx)comp_topo_.n_node_total()}),
-          node_status_(comp_topo_.n_node_total(), -1) {}
+          predecessors_(comp_topo_.n_node_total()),
+          node_color_(comp_topo_.n_node_total(), DFSColor::white),
+          node_status_(comp_topo_.n_node_total(), -1) {
+        // predecessors is initialized as 0, 1, 2, ..., n_node_total() - 1
+        std::iota(predecessors_.begin(), predecessors_.end(), GraphIdx{0});
+        // the dfs stack cannot be deeper than the number of nodes, so it never reallocates
+        dfs_stack_.reserve(comp_topo_.n_node_total());
+    }
+
+    // with the math models of a previous topology
+    // a meshed math model which is a subgraph of a previous math model reuses its node ordering and fill-ins
+    Topology(ComponentTopology const& comp_topo, ComponentConnections const& comp_conn,
+             std::vector<std::shared_ptr<MathModelTopology const>> const& cached_math_topology,
+             TopologicalComponentToMathCoupling const& cached_comp_coup)
+        : Topology{comp_topo, comp_conn} {
+        cached_math_topology_ = &cached_math_topology;
+        cached_comp_coup_ = &cached_comp_coup;
+    }
 
     // build topology
     std::pair<std::vector<std::shared_ptr<MathModelTopology const>>,
@@ -138,10 +109,16 @@ class Topology {
     ComponentTopology const& comp_topo_;    // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
     ComponentConnections const& comp_conn_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
 
+    // math models of a previous topology, if any
+    std::vector<std::shared_ptr<MathModelTopology const>> const* cached_math_topology_{};
+    TopologicalComponentToMathCoupling const* cached_comp_coup_{};
+
     // intermediate
     GlobalGraph global_graph_;
     DoubleVector phase_shift_;
     std::vector<GraphIdx> predecessors_;
+    std::vector<DFSColor> node_color_;
+    std::vector<DFSStackEntry> dfs_stack_;
     // node status
     // -1, node not processed, assuming that node in the far end of a tree structure
     // -2, node in cycles or between the source and cycles, reordering not yet happened
@@ -167,8 +144,9 @@ class Topology {
     }
 
     void build_sparse_graph() {
-        std::vector<std::pair<GraphIdx, GraphIdx>> edges;
-        std::vector<GlobalEdge> edge_props;
+        // unsorted directed edges, with source node
+        std::vector<std::pair<GraphIdx, GlobalEdge>> edges;
+        edges.reserve(2 * (comp_topo_.branch_node_idx.size() + 3 * comp_topo_.branch3_node_idx.size()));
         // k as branch number for 2-way branch
         for (Idx k = 0; k != static_cast<Idx>(comp_topo_.branch_node_idx.size()); ++k) {
             auto const [i, j] = comp_topo_.branch_node_idx[k];
@@ -177,11 +155,9 @@ class Topology {
             double const phase_shift = comp_conn_.branch_phase_shift[k];
             if (i_status != 0 && j_status != 0) {
                 // node_j - node_i
-                edges.emplace_back((GraphIdx)i, (GraphIdx)j);
-                edge_props.push_back({-phase_shift});
+                edges.push_back({i, {.target = j, .phase_shift = -phase_shift}});
                 // node_i - node_j
-                edges.emplace_back((GraphIdx)j, (GraphIdx)i);
-                edge_props.push_back({phase_shift});
+                edges.push_back({j, {.target = i, .phase_shift = phase_shift}});
             }
         }
         // k as branch number for 3-way branch
@@ -196,20 +172,81 @@ class Topology {
             for (Idx m = 0; m != 3; ++m) {
                 if (i_status[m] != 0) {
                     // node_internal - node_i
-                    edges.emplace_back((GraphIdx)i[m], (GraphIdx)j_internal);
-                    edge_props.push_back({-phase_shift[m]});
+                    edges.push_back({i[m], {.target = j_internal, .phase_shift = -phase_shift[m]}});
                     // node_i - node_internal
-                    edges.emplace_back((GraphIdx)j_internal, (GraphIdx)i[m]);
-                    edge_props.push_back({phase_shift[m]});
+                    edges.push_back({j_internal, {.target = i[m], .phase_shift = phase_shift[m]}});
                 }
             }
         }
         // build graph
-        global_graph_ = GlobalGraph{boost::edges_are_unsorted_multi_pass, edges.cbegin(), edges.cend(),
-                                    edge_props.cbegin(), (GraphIdx)comp_topo_.n_node_total()};
-        // set color
-        BGL_FORALL_VERTICES(v, global_graph_, GlobalGraph) {
-            global_graph_[v].color = boost::default_color_type::white_color;
+        // counting sort of the edges by source node, the order of the out edges of each node is kept
+        Idx const n_node_total = comp_topo_.n_node_total();
+        IdxVector& row_indptr = global_graph_.row_indptr;
+        row_indptr.assign(n_node_total + 1, 0);
+        for (auto const& [source, edge] : edges) {
+            ++row_indptr[source + 1];
+        }
+        for (Idx i = 1; i != n_node_total + 1; ++i) {
+            row_indptr[i] += row_indptr[i - 1];
+        }
+        global_graph_.edges.resize(edges.size());
+        IdxVector counter(row_indptr.cbegin() + 1, row_indptr.cend());
+        for (auto it_edge = edges.crbegin(); it_edge != edges.crend(); ++it_edge) {
+            global_graph_.edges[--counter[it_edge->first]] = it_edge->second;
+        }
+    }
+
+    // discover node in the dfs search
+    // assign node to math group
+    // append node to dfs list
+    void discover_node(GraphIdx node, Idx math_group, std::vector<Idx>& dfs_node) {
+        node_color_[node] = DFSColor::gray;
+        comp_coup_.node[node].group = math_group;
+        dfs_node.push_back(node);
+        dfs_stack_.push_back({.node = node, .next_edge = global_graph_.row_indptr[node]});
+    }
+
+    // iterative depth-first search from a source node
+    void depth_first_visit(GraphIdx source_node, Idx math_group, std::vector<Idx>& dfs_node,
+                           std::vector<std::pair<GraphIdx, GraphIdx>>& back_edges) {
+        assert(dfs_stack_.empty());
+        discover_node(source_node, math_group, dfs_node);
+        while (!dfs_stack_.empty()) {
+            auto& [node, next_edge] = dfs_stack_.back();
+            // all out edges examined, finish node
+            if (next_edge == global_graph_.row_indptr[node + 1]) {
+                node_color_[node] = DFSColor::black;
+                dfs_stack_.pop_back();
+                continue;
+            }
+            GraphIdx const source = node;
+            GlobalEdge const& edge = global_graph_.edges[next_edge++];
+            GraphIdx const target = edge.target;
+            switch (node_color_[target]) {
+            case DFSColor::white:
+                // tree edge
+                // accumulate phase shift
+                // assign predecessor
+                phase_shift_[target] = phase_shift_[source] + edge.phase_shift;
+                predecessors_[target] = source;
+                discover_node(target, math_group, dfs_node);
+                break;
+            case DFSColor::gray:
+                // back edge, judge if it forms a cycle
+                // if this edge matches in the current tree as target->source
+                // it does not form a cycle, but an anti-parallel edge
+                // else it forms a cycle
+                if (predecessors_[source] != target) {
+                    back_edges.emplace_back(source, target);
+                }
+                break;
+            default:
+                // forward_or_cross_edge
+                // in symmetric directed graph (equivalent to undirected)
+                //    forward edge is ignored
+                //    cross edge does not exist
+                break;
+            }
         }
     }
 
@@ -233,10 +270,7 @@ class Topology {
             // back edges
             std::vector<std::pair<GraphIdx, GraphIdx>> back_edges;
             // start dfs search
-            boost::depth_first_visit(
-                global_graph_, (GraphIdx)source_node,
-                GlobalDFSVisitor{math_solver_idx, comp_coup_.node, phase_shift_, dfs_node, predecessors_, back_edges},
-                boost::get(&GlobalVertex::color, global_graph_));
+            depth_first_visit(source_node, math_solver_idx, dfs_node, back_edges);
 
             // begin to construct math topology
             MathModelTopology math_topo_single{};
@@ -246,6 +280,10 @@ class Topology {
                 // just reverse the node
                 std::ranges::reverse(dfs_node);
                 math_topo_single.is_radial = true;
+            } else if (reuse_cached_ordering(dfs_node, math_topo_single.fill_in)) {
+                // with cycles, meshed graph
+                // subgraph of a previous math model, its ordering is still valid
+                math_topo_single.is_radial = false;
             } else {
                 // with cycles, meshed graph
                 // use minimum degree
@@ -274,6 +312,84 @@ class Topology {
         }
     }
 
+    // re-order dfs_node as in a previous math model of which the current math model is a subgraph
+    // the previous branches and fill-ins form a graph which is closed under elimination in the previous node order
+    // so is every induced subgraph of it, in the same relative order
+    // the previous branches which are no longer in the current math model are kept as explicit fill-ins
+    // return false if there is no such previous math model, the dfs_node is then unchanged
+    bool reuse_cached_ordering(std::vector<Idx>& dfs_node, std::vector<BranchIdx>& fill_in) const {
+        if (cached_comp_coup_ == nullptr) {
+            return false;
+        }
+        auto const& cached_node = cached_comp_coup_->node;
+        Idx const cached_group = cached_node[dfs_node.front()].group;
+        if (cached_group == -1 ||
+            !std::ranges::all_of(dfs_node, [&cached_node, cached_group](Idx node) {
+                return cached_node[node].group == cached_group;
+            })) {
+            return false;
+        }
+        MathModelTopology const& cached_topo = *(*cached_math_topology_)[cached_group];
+
+        // previous branches, as bus pairs from low to high previous bus number
+        auto const ordered_pair = [](Idx bus1, Idx bus2) {
+            return std::pair{std::min(bus1, bus2), std::max(bus1, bus2)};
+        };
+        std::vector<std::pair<Idx, Idx>> cached_branches;
+        cached_branches.reserve(cached_topo.branch_bus_idx.size());
+        for (auto const& [bus1, bus2] : cached_topo.branch_bus_idx) {
+            if (bus1 != -1 && bus2 != -1) {
+                cached_branches.push_back(ordered_pair(bus1, bus2));
+            }
+        }
+        std::ranges::sort(cached_branches);
+        cached_branches.erase(std::ranges::unique(cached_branches).begin(), cached_branches.end());
+        std::vector<std::pair<Idx, Idx>> cached_fill_ins;
+        cached_fill_ins.reserve(cached_topo.fill_in.size());
+        std::ranges::transform(cached_topo.fill_in, std::back_inserter(cached_fill_ins),
+                               [&ordered_pair](BranchIdx const& entry) { return ordered_pair(entry[0], entry[1]); });
+        std::ranges::sort(cached_fill_ins);
+
+        // every current edge should be a previous branch or fill-in
+        std::vector<std::pair<Idx, Idx>> branches;
+        for (Idx const node : dfs_node) {
+            for (Idx edge = global_graph_.row_indptr[node]; edge != global_graph_.row_indptr[node + 1]; ++edge) {
+                auto const branch =
+                    ordered_pair(cached_node[node].pos, cached_node[global_graph_.edges[edge].target].pos);
+                if (!std::ranges::binary_search(cached_branches, branch) &&
+                    !std::ranges::binary_search(cached_fill_ins, branch)) {
+                    return false;
+                }
+                branches.push_back(branch);
+            }
+        }
+        std::ranges::sort(branches);
+
+        // order the nodes as in the previous math model
+        std::ranges::sort(dfs_node, {}, [&cached_node](Idx node) { return cached_node[node].pos; });
+        IdxVector cached_to_current(cached_topo.n_bus(), -1);
+        for (Idx bus = 0; bus != static_cast<Idx>(dfs_node.size()); ++bus) {
+            cached_to_current[cached_node[dfs_node[bus]].pos] = bus;
+        }
+        auto const in_current = [&cached_to_current](Idx bus1, Idx bus2) {
+            return cached_to_current[bus1] != -1 && cached_to_current[bus2] != -1;
+        };
+        // previous fill-ins, in the same order
+        // a previous fill-in which is now a current branch, e.g. by closing a switch, is an entry of the Y bus already
+        for (auto const& [bus1, bus2] : cached_topo.fill_in) {
+            if (in_current(bus1, bus2) && !std::ranges::binary_search(branches, ordered_pair(bus1, bus2))) {
+                fill_in.push_back({cached_to_current[bus1], cached_to_current[bus2]});
+            }
+        }
+        // previous branches which are no longer a current branch
+        for (auto const& [bus1, bus2] : cached_branches) {
+            if (in_current(bus1, bus2) && !std::ranges::binary_search(branches, std::pair{bus1, bus2})) {
+                fill_in.push_back({cached_to_current[bus1], cached_to_current[bus2]});
+            }
+        }
+        return true;
+    }
+
     // re-order dfs_node using minimum degree
     // return list of fill-ins when factorize the matrix
     std::vector<BranchIdx> reorder_node(std::vector<Idx>& dfs_node,
@@ -666,4 +782,81 @@ class Topology {
     }
 };
 
+// find the math models of a previous topology that are not affected by a change to the new topology
+// a math model is unaffected if it has the same math model topology and all components are coupled to the same
+// positions in it, so that its Y bus and math solver stay valid
+// returns for each new math model the sequence number of the unaffected previous math model, or -1 if there is none
+inline IdxVector find_unaffected_math_models(
+    std::vector<std::shared_ptr<MathModelTopology const>> const& old_math_topology,
+    TopologicalComponentToMathCoupling const& old_comp_coup,
+    std::vector<std::shared_ptr<MathModelTopology const>> const& new_math_topology,
+    TopologicalComponentToMathCoupling const& new_comp_coup) {
+    constexpr Idx unmatched{-1};
+    IdxVector new_to_old(new_math_topology.size(), unmatched);
+    IdxVector old_to_new(old_math_topology.size(), unmatched);
+
+    auto const unmatch = [&new_to_old, &old_to_new](Idx new_group, Idx old_group) {
+        if (new_group != unmatched) {
+            new_to_old[new_group] = unmatched;
+        }
+        if (old_group != unmatched) {
+            old_to_new[old_group] = unmatched;
+        }
+    };
+
+    // pair every new math model with the previous math model of its first node
+    std::vector<bool> paired(new_math_topology.size(), false);
+    assert(old_comp_coup.node.size() == new_comp_coup.node.size());
+    for (size_t node = 0; node != new_comp_coup.node.size(); ++node) {
+        Idx2D const& new_node = new_comp_coup.node[node];
+        Idx2D const& old_node = old_comp_coup.node[node];
+        if (new_node.group == unmatched || paired[new_node.group]) {
+            continue;
+        }
+        paired[new_node.group] = true;
+        if (old_node.group != unmatched && old_to_new[old_node.group] == unmatched) {
+            new_to_old[new_node.group] = old_node.group;
+            old_to_new[old_node.group] = new_node.group;
+        }
+    }
+
+    // all components of paired math models should be coupled to the same positions in both of them
+    auto const check_coupling = [&new_to_old, &old_to_new, &unmatch](auto const& new_coupling,
+                                                                      auto const& old_coupling) {
+        assert(new_coupling.size() == old_coupling.size());
+        for (size_t component = 0; component != new_coupling.size(); ++component) {
+            auto const& new_idx = new_coupling[component];
+            auto const& old_idx = old_coupling[component];
+            bool const same_pos = new_idx.pos == old_idx.pos;
+            if (new_idx.group != unmatched && new_to_old[new_idx.group] != unmatched &&
+                (new_to_old[new_idx.group] != old_idx.group || !same_pos)) {
+                unmatch(new_idx.group, new_to_old[new_idx.group]);
+            }
+            if (old_idx.group != unmatched && old_to_new[old_idx.group] != unmatched &&
+                (old_to_new[old_idx.group] != new_idx.group || !same_pos)) {
+                unmatch(old_to_new[old_idx.group], old_idx.group);
+            }
+        }
+    };
+    check_coupling(new_comp_coup.node, old_comp_coup.node);
+    check_coupling(new_comp_coup.branch, old_comp_coup.branch);
+    check_coupling(new_comp_coup.branch3, old_comp_coup.branch3);
+    check_coupling(new_comp_coup.shunt, old_comp_coup.shunt);
+    check_coupling(new_comp_coup.load_gen, old_comp_coup.load_gen);
+    check_coupling(new_comp_coup.source, old_comp_coup.source);
+    check_coupling(new_comp_coup.voltage_sensor, old_comp_coup.voltage_sensor);
+    check_coupling(new_comp_coup.power_sensor, old_comp_coup.power_sensor);
+    check_coupling(new_comp_coup.current_sensor, old_comp_coup.current_sensor);
+    check_coupling(new_comp_coup.regulator, old_comp_coup.regulator);
+
+    // the connections within the math model, e.g. the branch statuses, should also be the same
+    for (Idx new_group = 0; new_group != static_cast<Idx>(new_to_old.size()); ++new_group) {
+        if (Idx const old_group = new_to_old[new_group];
+            old_group != unmatched && *new_math_topology[new_group] != *old_math_topology[old_group]) {
+            unmatch(new_group, old_group);
+        }
+    }
+    return new_to_old;
+}
+
 } // namespace power_grid_model
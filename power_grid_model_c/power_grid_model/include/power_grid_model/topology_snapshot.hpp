@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+// versioned binary snapshot of the node ordering of the math models
+
+#include "calculation_parameters.hpp"
+
+#include "common/common.hpp"
+#include "common/exception.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace power_grid_model {
+
+// The snapshot contains, for every math model, the bus ordering with the branches and fill-ins of the factorization.
+// When it is loaded in a model with the same nodes, the topology of that model reuses the ordering for every math
+// model which is a subgraph of a snapshot math model, instead of running the minimum degree ordering.
+//
+// Layout, all values in native byte order, without padding:
+//    header: magic (8 bytes), version (uint32), byte order mark (uint32), n_node (Idx), n_math_model (Idx)
+//    n_node times Idx2D: math model and bus of each node, including the internal nodes of three-winding branches
+//        group -1 if the node is isolated
+//    per math model: n_bus, n_branch and n_fill_in (Idx), followed by n_branch and n_fill_in times BranchIdx
+// The arrays are copied in bulk, so a memory-mapped file can be loaded without parsing.
+struct TopologySnapshot {
+    static constexpr std::array<char, 8> magic{'P', 'G', 'M', 'T', 'O', 'P', 'O', '\0'};
+    static constexpr uint32_t version = 1;
+    static constexpr uint32_t byte_order_mark = 0x01020304;
+
+    std::vector<std::shared_ptr<MathModelTopology const>> math_topology;
+    std::shared_ptr<TopologicalComponentToMathCoupling const> comp_coup;
+
+    Idx n_node() const { return comp_coup == nullptr ? 0 : static_cast<Idx>(comp_coup->node.size()); }
+};
+
+namespace detail {
+
+class SnapshotWriter {
+  public:
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(T const& value) {
+        write(std::span<T const>{&value, 1});
+    }
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(std::span<T const> values) {
+        auto const* const begin = reinterpret_cast<char const*>(values.data());
+        buffer_.insert(buffer_.end(), begin, begin + values.size_bytes());
+    }
+
+    std::vector<char> release() { return std::move(buffer_); }
+
+  private:
+    std::vector<char> buffer_;
+};
+
+class SnapshotReader {
+  public:
+    explicit SnapshotReader(std::span<char const> data) : data_{data} {}
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    T read() {
+        T value;
+        read(std::span<T>{&value, 1});
+        return value;
+    }
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void read(std::span<T> values) {
+        if (values.size_bytes() > data_.size() - pos_) {
+            throw SerializationError{"Topology snapshot is truncated!\n"};
+        }
+        std::memcpy(values.data(), data_.data() + pos_, values.size_bytes());
+        pos_ += values.size_bytes();
+    }
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    std::vector<T> read_vector(Idx size) {
+        // check before allocating, the size may be corrupt
+        if (static_cast<size_t>(size) > (data_.size() - pos_) / sizeof(T)) {
+            throw SerializationError{"Topology snapshot is truncated!\n"};
+        }
+        std::vector<T> values(size);
+        read(std::span{values});
+        return values;
+    }
+    Idx read_size() {
+        auto const size = read<Idx>();
+        if (size < 0) {
+            throw SerializationError{"Topology snapshot contains a negative size!\n"};
+        }
+        return size;
+    }
+
+    bool at_end() const { return pos_ == data_.size(); }
+
+  private:
+    std::span<char const> data_;
+    size_t pos_{};
+};
+
+// the bus numbers should be in range
+// the branches and fill-ins should form a graph which is closed under elimination in the bus order,
+// i.e. the higher neighbours of every bus are all connected to the lowest one of them
+inline bool is_valid_ordering(MathModelTopology const& math_topo) {
+    Idx const n_bus = math_topo.n_bus();
+    auto const in_range = [n_bus](Idx bus) { return bus >= 0 && bus < n_bus; };
+    if (!std::ranges::all_of(math_topo.branch_bus_idx,
+                             [&in_range](BranchIdx const& branch) {
+                                 return (branch[0] == -1 || in_range(branch[0])) &&
+                                        (branch[1] == -1 || in_range(branch[1]));
+                             }) ||
+        !std::ranges::all_of(math_topo.fill_in, [&in_range](BranchIdx const& fill_in) {
+            return in_range(fill_in[0]) && in_range(fill_in[1]);
+        })) {
+        return false;
+    }
+
+    std::vector<IdxVector> higher_neighbours(n_bus);
+    auto const add_edge = [&higher_neighbours](BranchIdx const& edge) {
+        auto const [bus_1, bus_2] = edge;
+        if (bus_1 != -1 && bus_2 != -1 && bus_1 != bus_2) {
+            higher_neighbours[std::min(bus_1, bus_2)].push_back(std::max(bus_1, bus_2));
+        }
+    };
+    std::ranges::for_each(math_topo.branch_bus_idx, add_edge);
+    std::ranges::for_each(math_topo.fill_in, add_edge);
+    for (IdxVector& neighbours : higher_neighbours) {
+        std::ranges::sort(neighbours);
+        neighbours.erase(std::ranges::unique(neighbours).begin(), neighbours.end());
+    }
+    return std::ranges::all_of(higher_neighbours, [&higher_neighbours](IdxVector const& neighbours) {
+        return neighbours.empty() ||
+               std::ranges::all_of(neighbours.cbegin() + 1, neighbours.cend(),
+                                   [&parent = higher_neighbours[neighbours.front()]](Idx bus) {
+                                       return std::ranges::binary_search(parent, bus);
+                                   });
+    });
+}
+
+} // namespace detail
+
+inline std::vector<char> serialize_topology_snapshot(TopologySnapshot const& snapshot) {
+    detail::SnapshotWriter writer;
+    writer.write(std::span<char const>{TopologySnapshot::magic});
+    writer.write(TopologySnapshot::version);
+    writer.write(TopologySnapshot::byte_order_mark);
+    writer.write(snapshot.n_node());
+    writer.write(static_cast<Idx>(snapshot.math_topology.size()));
+    if (snapshot.comp_coup != nullptr) {
+        writer.write(std::span{snapshot.comp_coup->node});
+    }
+    for (auto const& math_topo : snapshot.math_topology) {
+        writer.write(math_topo->n_bus());
+        writer.write(math_topo->n_branch());
+        writer.write(static_cast<Idx>(math_topo->fill_in.size()));
+        writer.write(std::span{math_topo->branch_bus_idx});
+        writer.write(std::span{math_topo->fill_in});
+    }
+    return writer.release();
+}
+
+// the loaded math models only contain the bus ordering, the branches and the fill-ins
+inline TopologySnapshot deserialize_topology_snapshot(std::span<char const> data) {
+    detail::SnapshotReader reader{data};
+    std::array<char, 8> magic{};
+    reader.read(std::span<char>{magic});
+    if (magic != TopologySnapshot::magic) {
+        throw SerializationError{"Data is not a topology snapshot!\n"};
+    }
+    if (auto const version = reader.read<uint32_t>(); version != TopologySnapshot::version) {
+        throw SerializationError{"Unsupported topology snapshot version: " + std::to_string(version) + "\n"};
+    }
+    if (reader.read<uint32_t>() != TopologySnapshot::byte_order_mark) {
+        throw SerializationError{"Topology snapshot was created on a platform with a different byte order!\n"};
+    }
+    Idx const n_node = reader.read_size();
+    Idx const n_math_model = reader.read_size();
+    if (n_math_model > n_node) {
+        throw SerializationError{"Topology snapshot contains more math models than nodes!\n"};
+    }
+
+    TopologicalComponentToMathCoupling comp_coup;
+    comp_coup.node = reader.read_vector<Idx2D>(n_node);
+
+    TopologySnapshot snapshot;
+    snapshot.math_topology.reserve(n_math_model);
+    Idx n_bus_total = 0;
+    for (Idx math_model_idx = 0; math_model_idx != n_math_model; ++math_model_idx) {
+        Idx const n_bus = reader.read_size();
+        Idx const n_branch = reader.read_size();
+        Idx const n_fill_in = reader.read_size();
+        if (n_bus > n_node - n_bus_total) {
+            throw SerializationError{"Topology snapshot contains more buses than nodes!\n"};
+        }
+        n_bus_total += n_bus;
+        MathModelTopology math_topo;
+        math_topo.phase_shift.resize(n_bus);
+        math_topo.branch_bus_idx = reader.read_vector<BranchIdx>(n_branch);
+        math_topo.fill_in = reader.read_vector<BranchIdx>(n_fill_in);
+
+        // the topology indexes its buffers with the bus numbers, so they are validated once here
+        if (!detail::is_valid_ordering(math_topo)) {
+            throw SerializationError{"Topology snapshot contains an invalid bus ordering!\n"};
+        }
+        snapshot.math_topology.push_back(std::make_shared<MathModelTopology const>(std::move(math_topo)));
+    }
+    // every bus should be assigned to exactly one node
+    std::vector<std::vector<bool>> bus_assigned(n_math_model);
+    for (Idx math_model_idx = 0; math_model_idx != n_math_model; ++math_model_idx) {
+        bus_assigned[math_model_idx].resize(snapshot.math_topology[math_model_idx]->n_bus());
+    }
+    for (Idx2D const& node : comp_coup.node) {
+        if (node.group == -1) {
+            continue;
+        }
+        if (node.group < 0 || node.group >= n_math_model || node.pos < 0 ||
+            node.pos >= snapshot.math_topology[node.group]->n_bus() || bus_assigned[node.group][node.pos]) {
+            throw SerializationError{"Topology snapshot contains an invalid node coupling!\n"};
+        }
+        bus_assigned[node.group][node.pos] = true;
+    }
+    if (!std::ranges::all_of(bus_assigned, [](std::vector<bool> const& assigned) {
+            return std::ranges::all_of(assigned, [](bool x) { return x; });
+        })) {
+        throw SerializationError{"Topology snapshot contains a math model with unassigned buses!\n"};
+    }
+    if (!reader.at_end()) {
+        throw SerializationError{"Topology snapshot contains trailing data!\n"};
+    }
+    snapshot.comp_coup = std::make_shared<TopologicalComponentToMathCoupling const>(std::move(comp_coup));
+    return snapshot;
+}
+
+} // namespace power_grid_model
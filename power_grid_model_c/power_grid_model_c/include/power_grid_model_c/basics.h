@@ -203,8 +203,9 @@ enum PGM_CType {
  *
  */
 enum PGM_SerializationFormat {
-    PGM_json = 0,    /**< JSON serialization format */
-    PGM_msgpack = 1, /**< msgpack serialization format */
+    PGM_json = 0,     /**< JSON serialization format */
+    PGM_msgpack = 1,  /**< msgpack serialization format */
+    PGM_columnar = 2, /**< native columnar binary format, see PGM_deserializer_create_columnar_dataset() */
 };
 
 /**
@@ -230,6 +231,8 @@ enum PGM_TapChangingStrategy {
         3, /**< adjust tap position automatically; optimize for the higher end of the voltage band */
     PGM_tap_changing_strategy_fast_any_tap =
         4, /**< adjust tap position automatically; optimize for any value in the voltage band; binary search */
+    PGM_tap_changing_strategy_sensitivity_any_tap =
+        5, /**< adjust tap position automatically; optimize for any value in the voltage band; sensitivity search */
 };
 
 /**
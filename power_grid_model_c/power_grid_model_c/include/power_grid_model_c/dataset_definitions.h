@@ -845,6 +845,10 @@ PGM_API extern PGM_MetaAttribute const* const PGM_def_sc_output_node_energized;
 PGM_API extern PGM_MetaAttribute const* const PGM_def_sc_output_node_u_pu;
 PGM_API extern PGM_MetaAttribute const* const PGM_def_sc_output_node_u;
 PGM_API extern PGM_MetaAttribute const* const PGM_def_sc_output_node_u_angle;
+PGM_API extern PGM_MetaAttribute const* const PGM_def_sc_output_node_i_f_three_phase;
+PGM_API extern PGM_MetaAttribute const* const PGM_def_sc_output_node_i_f_three_phase_angle;
+PGM_API extern PGM_MetaAttribute const* const PGM_def_sc_output_node_i_f_single_phase;
+PGM_API extern PGM_MetaAttribute const* const PGM_def_sc_output_node_i_f_single_phase_angle;
 // component line
 PGM_API extern PGM_MetaComponent const* const PGM_def_sc_output_line;
 // attributes of sc_output line
@@ -111,6 +111,47 @@ PGM_API void PGM_get_indexer(PGM_Handle* handle, PGM_PowerGridModel const* model
 PGM_API void PGM_calculate(PGM_Handle* handle, PGM_PowerGridModel* model, PGM_Options const* opt,
                            PGM_MutableDataset const* output_dataset, PGM_ConstDataset const* batch_dataset);
 
+/**
+ * @brief Get a binary snapshot of the node ordering of the model.
+ *
+ * The snapshot contains the bus ordering and the fill-ins of all mathematical models.
+ * It can be stored, e.g. in a file, and loaded into a new model of the same grid with PGM_load_topology_snapshot(),
+ * so that the new model does not need to compute the node ordering again.
+ * The topology of the model is built if it is not up to date.
+ * The snapshot has a versioned binary format in the native byte order of the platform.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param data Output argument: the data pointer of the snapshot will be written to *data.
+ *   The data is owned by the model and valid until the next call to this function or the destruction of the model.
+ * @param size Output argument: the length of the snapshot will be written to *size.
+ * @return
+ */
+PGM_API void PGM_get_topology_snapshot(PGM_Handle* handle, PGM_PowerGridModel* model, char const** data,
+                                       PGM_Idx* size);
+
+/**
+ * @brief Load a binary snapshot of the node ordering, created by PGM_get_topology_snapshot().
+ *
+ * The next time the topology is built, every meshed mathematical model which is a subgraph of a mathematical model
+ * in the snapshot reuses its node ordering.
+ * The other mathematical models are ordered as usual.
+ * The data is copied, so the buffer can be released (e.g. unmapped) after the call.
+ *
+ * Use PGM_error_code() and PGM_error_message() to check the error.
+ * The error code is PGM_serialization_error if the data is not a valid snapshot for this model.
+ *
+ * @param handle
+ * @param model A pointer to an existing model.
+ * @param data A pointer to the snapshot data.
+ * @param size The length of the snapshot data.
+ * @return
+ */
+PGM_API void PGM_load_topology_snapshot(PGM_Handle* handle, PGM_PowerGridModel* model, char const* data,
+                                        PGM_Idx size);
+
 /**
  * @brief Destroy the model returned by PGM_create_model() or PGM_copy_model().
  *
@@ -29,7 +29,11 @@ extern "C" {
  *   - max_iter: 20
  *   - threading: -1
  *   - short_circuit_voltage_scaling: PGM_short_circuit_voltage_scaling_maximum
+ *   - short_circuit_fault_scan: 0
  *   - experimental_features: PGM_experimental_features_disabled
+ *   - state_estimation_tracking: 0
+ *   - speculative_tap_search: 0
+ *   - tap_warm_start: 0
  *
  * @param handle
  * @return The pointer to the option instance. Should be freed by PGM_destroy_options().
@@ -91,7 +95,7 @@ PGM_API void PGM_set_err_tol(PGM_Handle* handle, PGM_Options* opt, double err_to
 PGM_API void PGM_set_max_iter(PGM_Handle* handle, PGM_Options* opt, PGM_Idx max_iter);
 
 /**
- * @brief Specify the multi-threading strategy. Only applicable for batch calculation.
+ * @brief Specify the multi-threading strategy. Only applicable for batch calculation and speculative tap search.
  *
  * @param handle
  * @param opt The pointer to the option instance.
@@ -112,6 +116,23 @@ PGM_API void PGM_set_threading(PGM_Handle* handle, PGM_Options* opt, PGM_Idx thr
 PGM_API void PGM_set_short_circuit_voltage_scaling(PGM_Handle* handle, PGM_Options* opt,
                                                    PGM_Idx short_circuit_voltage_scaling);
 
+/**
+ * @brief Enable/disable the fault scan of short circuit calculations.
+ *
+ * When enabled, the short circuit calculation also calculates the currents of a bolted fault at every node,
+ * as if each node were faulted on its own, in addition to the faults in the input.
+ * The network including the sources is factorized only once for all nodes.
+ * The results are in the i_f_three_phase and i_f_single_phase attributes of the node short circuit output.
+ * The calculation is then always asymmetric, also if all faults in the input are three phase faults.
+ *
+ * Only valid for short circuit calculations.
+ *
+ * @param handle
+ * @param opt pointer to option instance
+ * @param fault_scan 1 for enabled, 0 for disabled
+ */
+PGM_API void PGM_set_short_circuit_fault_scan(PGM_Handle* handle, PGM_Options* opt, PGM_Idx fault_scan);
+
 /**
  * @brief Specify the tap changing strategy for power flow calculations
  *
@@ -121,6 +142,67 @@ PGM_API void PGM_set_short_circuit_voltage_scaling(PGM_Handle* handle, PGM_Optio
  */
 PGM_API void PGM_set_tap_changing_strategy(PGM_Handle* handle, PGM_Options* opt, PGM_Idx tap_changing_strategy);
 
+/**
+ * @brief Enable/disable the tracking mode of state estimation.
+ *
+ * [Experimental]
+ *
+ * In tracking mode, every state estimation on the same model starts its iterations from the result of the previous
+ * successful state estimation, instead of from a flat start.
+ * This speeds up repeated state estimations with slowly changing measurements, e.g. in real-time monitoring.
+ * The result of a calculation then depends on the calculations that were executed before on the same model.
+ * The previous estimate is discarded when the topology changes.
+ * In a batch calculation, every thread keeps its own previous estimate.
+ *
+ * Only valid for state estimation.
+ *
+ * @param handle
+ * @param opt pointer to option instance
+ * @param tracking 1 for enabled, 0 for disabled
+ */
+PGM_API void PGM_set_state_estimation_tracking(PGM_Handle* handle, PGM_Options* opt, PGM_Idx tracking);
+
+/**
+ * @brief Enable/disable the speculative tap search of the tap position optimizer.
+ *
+ * When enabled, the binary search of the tap position optimizer calculates the power flow of the next tap positions
+ * in parallel with the current one, on copies of the model, so that the next step does not have to wait for it.
+ * The number of parallel threads is taken from the threading option, see PGM_set_threading().
+ * The results are the same as without speculative tap search.
+ *
+ * The speculation is only done if the binary search adjusts a single transformer at the same time.
+ * In a batch calculation with multiple scenarios, the threads are used for the scenarios instead.
+ *
+ * Only valid for power flow calculations with a tap changing strategy.
+ *
+ * @param handle
+ * @param opt pointer to option instance
+ * @param speculative_tap_search 1 for enabled, 0 for disabled
+ */
+PGM_API void PGM_set_speculative_tap_search(PGM_Handle* handle, PGM_Options* opt, PGM_Idx speculative_tap_search);
+
+/**
+ * @brief Enable/disable the warm start of the tap position optimizer in batch calculations.
+ *
+ * When enabled, the tap position search of a scenario starts from the tap positions found in the previous scenario
+ * that was calculated by the same thread, instead of from the input tap positions.
+ * The binary search is first restricted to the tap positions close to that starting point, and only searches the full
+ * tap range if no result was found there.
+ *
+ * Only applicable to the tap changing strategies PGM_tap_changing_strategy_any_valid_tap,
+ * PGM_tap_changing_strategy_fast_any_tap and PGM_tap_changing_strategy_sensitivity_any_tap,
+ * which accept any tap position that results in a voltage in the band.
+ * The found tap positions may therefore differ from the ones without warm start.
+ * The other strategies start from the extreme tap positions regardless of this option.
+ *
+ * Only valid for power flow calculations with a tap changing strategy.
+ *
+ * @param handle
+ * @param opt pointer to option instance
+ * @param tap_warm_start 1 for enabled, 0 for disabled
+ */
+PGM_API void PGM_set_tap_warm_start(PGM_Handle* handle, PGM_Options* opt, PGM_Idx tap_warm_start);
+
 /**
  * @brief Enable/disable experimental features.
  *
@@ -41,6 +41,22 @@ PGM_API PGM_Deserializer* PGM_create_deserializer_from_null_terminated_string(PG
                                                                               char const* data_string,
                                                                               PGM_Idx serialization_format);
 
+/**
+ * @brief Create a deserializer from a file.
+ *     The file is mapped into memory and the data is read in place, without a copy.
+ *     The operating system loads the pages of the file on demand and can evict them again,
+ *     so the file does not need to fit in memory.
+ *     JSON which cannot be read directly is converted to msgpack in memory, like the other JSON input.
+ * @param handle
+ * @param file_path The path to the file as a null-terminated UTF-8 C string.
+ * @param serialization_format The desired data format of the serialization. See #PGM_SerializationFormat .
+ * @return A pointer to the deserializer instance. Should be freed by PGM_destroy_deserializer().
+ *     Returns NULL if errors occured (check the handle for error information).
+ *     The file should not be modified until the deserializer is destroyed.
+ */
+PGM_API PGM_Deserializer* PGM_create_deserializer_from_file(PGM_Handle* handle, char const* file_path,
+                                                            PGM_Idx serialization_format);
+
 /**
  * @brief Get the PGM_WritableDataset object from the deserializer.
  * @param handle
@@ -52,6 +68,20 @@ PGM_API PGM_Deserializer* PGM_create_deserializer_from_null_terminated_string(PG
  */
 PGM_API PGM_WritableDataset* PGM_deserializer_get_dataset(PGM_Handle* handle, PGM_Deserializer* deserializer);
 
+/**
+ * @brief Set the number of threads to parse the scenarios of a batch dataset.
+ *     The scenarios are split in contiguous blocks, which are parsed in parallel.
+ *     The result does not depend on the number of threads.
+ * @param handle
+ * @param deserializer The pointer to the deserializer
+ * @param threading The value of the threading setting, in the same way as PGM_set_threading(). See below:
+ *   - -1: No multi-threading, parse sequentially (default).
+ *   - 0: use number of machine available threads.
+ *   - >0: specify number of threads you want to parse in parallel.
+ * @return No return value; check handle for error.
+ */
+PGM_API void PGM_deserializer_set_threading(PGM_Handle* handle, PGM_Deserializer* deserializer, PGM_Idx threading);
+
 /**
  * @brief Parse the dataset and write to the user-provided buffers.
  *     The buffers must be set through PGM_writable_dataset_set_buffer().
@@ -61,6 +91,37 @@ PGM_API PGM_WritableDataset* PGM_deserializer_get_dataset(PGM_Handle* handle, PG
  */
 PGM_API void PGM_deserializer_parse_to_buffer(PGM_Handle* handle, PGM_Deserializer* deserializer);
 
+/**
+ * @brief Select a range of consecutive scenarios of the dataset to be parsed.
+ *     After this call, the dataset of the deserializer only describes the selected scenarios:
+ *     the batch size and the number of elements are those of the selected scenarios.
+ *     The buffers of the dataset are reset and should be set again before PGM_deserializer_parse_to_buffer().
+ *     In this way a large batch dataset can be parsed chunk by chunk, reusing buffers of bounded size.
+ *     By default, all scenarios are selected.
+ * @param handle
+ * @param deserializer The pointer to the deserializer
+ * @param first_scenario The first scenario to select.
+ * @param n_scenarios The number of scenarios to select.
+ *     For a single dataset, the only valid selection is first_scenario = 0 and n_scenarios = 1.
+ * @return No return value; check handle for error.
+ */
+PGM_API void PGM_deserializer_select_scenarios(PGM_Handle* handle, PGM_Deserializer* deserializer,
+                                               PGM_Idx first_scenario, PGM_Idx n_scenarios);
+
+/**
+ * @brief Create a constant dataset referring directly to the data of a deserializer in the #PGM_columnar format.
+ *     Nothing is parsed or copied, the dataset can be used right away, e.g. as a (batch) update dataset.
+ *     The dataset holds all scenarios, regardless of PGM_deserializer_select_scenarios().
+ *     The data should be aligned in memory, which is the case for PGM_create_deserializer_from_file().
+ * @param handle
+ * @param deserializer The pointer to the deserializer.
+ * @return A pointer to the new constant dataset. Should be freed by PGM_destroy_dataset_const().
+ *     The dataset refers to the data of the deserializer and should not outlive it.
+ *     Returns NULL if errors occured (check the handle for error information).
+ */
+PGM_API PGM_ConstDataset* PGM_deserializer_create_columnar_dataset(PGM_Handle* handle,
+                                                                   PGM_Deserializer const* deserializer);
+
 /**
  * @brief Destory deserializer
  * @param deserializer pointer to deserializer
@@ -104,6 +165,49 @@ PGM_API void PGM_serializer_get_to_binary_buffer(PGM_Handle* handle, PGM_Seriali
 PGM_API char const* PGM_serializer_get_to_zero_terminated_string(PGM_Handle* handle, PGM_Serializer* serializer,
                                                                  PGM_Idx use_compact_list, PGM_Idx indent);
 
+/**
+ * @brief Callback receiving the serialized data piece by piece.
+ * @param user_data The user data pointer as provided to PGM_serializer_write_to_callback().
+ * @param data A pointer to the next piece of serialized data. Only valid during the call.
+ * @param size The length of the piece.
+ * @return 0 if the piece is consumed successfully. Any other value aborts the serialization.
+ */
+typedef PGM_Idx (*PGM_WriteCallback)(void* user_data, char const* data, PGM_Idx size);
+
+/**
+ * @brief Serialize the dataset and stream the result to a callback.
+ *     The data is handed over in pieces of bounded size,
+ *     so the full serialized output is never kept in memory.
+ *     The concatenated pieces are equal to the output of PGM_serializer_get_to_binary_buffer()
+ *     or PGM_serializer_get_to_zero_terminated_string() (without the zero termination).
+ * @param handle
+ * @param serializer A pointer to an existing serializer.
+ * @param use_compact_list 1 for use compact list per element of serialization; 0 for use dictionary per element.
+ * @param indent The indentation of the JSON, use -1 for no indent and no new line (compact format).
+ *     Ignored for binary data formats.
+ * @param callback The callback receiving the serialized data.
+ * @param user_data A pointer that is passed to every call of the callback.
+ * @return No return value; check handle for error.
+ *     A non-zero return value of the callback results in a serialization error.
+ */
+PGM_API void PGM_serializer_write_to_callback(PGM_Handle* handle, PGM_Serializer* serializer,
+                                              PGM_Idx use_compact_list, PGM_Idx indent, PGM_WriteCallback callback,
+                                              void* user_data);
+
+/**
+ * @brief Serialize the dataset and stream the result to a file.
+ *     An existing file is overwritten.
+ * @param handle
+ * @param serializer A pointer to an existing serializer.
+ * @param file_path The UTF-8 encoded path of the file.
+ * @param use_compact_list 1 for use compact list per element of serialization; 0 for use dictionary per element.
+ * @param indent The indentation of the JSON, use -1 for no indent and no new line (compact format).
+ *     Ignored for binary data formats.
+ * @return No return value; check handle for error.
+ */
+PGM_API void PGM_serializer_write_to_file(PGM_Handle* handle, PGM_Serializer* serializer, char const* file_path,
+                                          PGM_Idx use_compact_list, PGM_Idx indent);
+
 /**
  * @brief Destroy serializer.
  * @param serializer The pointer to the serializer.
@@ -834,6 +834,10 @@ PGM_MetaAttribute const* const PGM_def_sc_output_node_energized = PGM_meta_get_a
 PGM_MetaAttribute const* const PGM_def_sc_output_node_u_pu = PGM_meta_get_attribute_by_name(nullptr, "sc_output", "node", "u_pu");
 PGM_MetaAttribute const* const PGM_def_sc_output_node_u = PGM_meta_get_attribute_by_name(nullptr, "sc_output", "node", "u");
 PGM_MetaAttribute const* const PGM_def_sc_output_node_u_angle = PGM_meta_get_attribute_by_name(nullptr, "sc_output", "node", "u_angle");
+PGM_MetaAttribute const* const PGM_def_sc_output_node_i_f_three_phase = PGM_meta_get_attribute_by_name(nullptr, "sc_output", "node", "i_f_three_phase");
+PGM_MetaAttribute const* const PGM_def_sc_output_node_i_f_three_phase_angle = PGM_meta_get_attribute_by_name(nullptr, "sc_output", "node", "i_f_three_phase_angle");
+PGM_MetaAttribute const* const PGM_def_sc_output_node_i_f_single_phase = PGM_meta_get_attribute_by_name(nullptr, "sc_output", "node", "i_f_single_phase");
+PGM_MetaAttribute const* const PGM_def_sc_output_node_i_f_single_phase_angle = PGM_meta_get_attribute_by_name(nullptr, "sc_output", "node", "i_f_single_phase_angle");
 // component line
 PGM_MetaComponent const* const PGM_def_sc_output_line = PGM_meta_get_component_by_name(nullptr, "sc_output", "line");
 // attributes of sc_output line
@@ -15,6 +15,9 @@
 #include <power_grid_model/common/common.hpp>
 #include <power_grid_model/main_model.hpp>
 
+#include <optional>
+#include <vector>
+
 namespace {
 using namespace power_grid_model;
 } // namespace
@@ -22,6 +25,9 @@ using namespace power_grid_model;
 // aliases main class
 struct PGM_PowerGridModel : public MainModel {
     using MainModel::MainModel;
+
+    // buffer of the last topology snapshot
+    std::vector<char> topology_snapshot;
 };
 
 // create model
@@ -55,6 +61,25 @@ void PGM_get_indexer(PGM_Handle* handle, PGM_PowerGridModel const* model, char c
         PGM_regular_error);
 }
 
+// get topology snapshot
+void PGM_get_topology_snapshot(PGM_Handle* handle, PGM_PowerGridModel* model, char const** data, PGM_Idx* size) {
+    call_with_catch(
+        handle,
+        [model, data, size] {
+            model->topology_snapshot = model->get_topology_snapshot();
+            *data = model->topology_snapshot.data();
+            *size = static_cast<PGM_Idx>(model->topology_snapshot.size());
+        },
+        PGM_regular_error);
+}
+
+// load topology snapshot
+void PGM_load_topology_snapshot(PGM_Handle* handle, PGM_PowerGridModel* model, char const* data, PGM_Idx size) {
+    call_with_catch(
+        handle, [model, data, size] { model->load_topology_snapshot({data, static_cast<size_t>(size)}); },
+        PGM_serialization_error);
+}
+
 namespace {
 void check_no_experimental_features_used(MainModel const& model, MainModel::Options const& opt) {
     // optionally add experimental feature checks here
@@ -70,6 +95,30 @@ void check_calculate_valid_options(PGM_Options const& opt) {
                                InvalidArguments::TypeValuePair{.name = "PGM_TapChangingStrategy",
                                                                .value = std::to_string(opt.tap_changing_strategy)}};
     }
+    if (opt.state_estimation_tracking != 0 && opt.calculation_type != PGM_state_estimation) {
+        // illegal combination of options
+        throw InvalidArguments{"PGM_calculate",
+                               InvalidArguments::TypeValuePair{.name = "state_estimation_tracking",
+                                                               .value = std::to_string(opt.state_estimation_tracking)}};
+    }
+    if (opt.short_circuit_fault_scan != 0 && opt.calculation_type != PGM_short_circuit) {
+        // illegal combination of options
+        throw InvalidArguments{"PGM_calculate",
+                               InvalidArguments::TypeValuePair{.name = "short_circuit_fault_scan",
+                                                               .value = std::to_string(opt.short_circuit_fault_scan)}};
+    }
+    if (opt.speculative_tap_search != 0 && opt.tap_changing_strategy == PGM_tap_changing_strategy_disabled) {
+        // illegal combination of options
+        throw InvalidArguments{"PGM_calculate",
+                               InvalidArguments::TypeValuePair{.name = "speculative_tap_search",
+                                                               .value = std::to_string(opt.speculative_tap_search)}};
+    }
+    if (opt.tap_warm_start != 0 && opt.tap_changing_strategy == PGM_tap_changing_strategy_disabled) {
+        // illegal combination of options
+        throw InvalidArguments{"PGM_calculate",
+                               InvalidArguments::TypeValuePair{.name = "tap_warm_start",
+                                                               .value = std::to_string(opt.tap_warm_start)}};
+    }
 }
 
 constexpr auto get_calculation_type(PGM_Options const& opt) {
@@ -101,6 +150,7 @@ constexpr auto get_optimizer_type(PGM_Options const& opt) {
     case PGM_tap_changing_strategy_max_voltage_tap:
     case PGM_tap_changing_strategy_min_voltage_tap:
     case PGM_tap_changing_strategy_fast_any_tap:
+    case PGM_tap_changing_strategy_sensitivity_any_tap:
         return automatic_tap_adjustment;
     default:
         throw MissingCaseForEnumError{"get_optimizer_type", opt.tap_changing_strategy};
@@ -113,6 +163,7 @@ constexpr auto get_optimizer_strategy(PGM_Options const& opt) {
     switch (opt.tap_changing_strategy) {
     case PGM_tap_changing_strategy_disabled:
     case PGM_tap_changing_strategy_any_valid_tap:
+    case PGM_tap_changing_strategy_sensitivity_any_tap:
         return any;
     case PGM_tap_changing_strategy_max_voltage_tap:
         return global_maximum;
@@ -125,6 +176,13 @@ constexpr auto get_optimizer_strategy(PGM_Options const& opt) {
     }
 }
 
+constexpr auto get_tap_search_method(PGM_Options const& opt) -> std::optional<SearchMethod> {
+    if (opt.tap_changing_strategy == PGM_tap_changing_strategy_sensitivity_any_tap) {
+        return SearchMethod::sensitivity_search;
+    }
+    return std::nullopt;
+}
+
 constexpr auto get_short_circuit_voltage_scaling(PGM_Options const& opt) {
     return static_cast<ShortCircuitVoltageScaling>(opt.short_circuit_voltage_scaling);
 }
@@ -135,10 +193,15 @@ constexpr auto extract_calculation_options(PGM_Options const& opt) {
                               .calculation_method = get_calculation_method(opt),
                               .optimizer_type = get_optimizer_type(opt),
                               .optimizer_strategy = get_optimizer_strategy(opt),
+                              .tap_search_method = get_tap_search_method(opt),
                               .err_tol = opt.err_tol,
                               .max_iter = opt.max_iter,
                               .threading = opt.threading,
-                              .short_circuit_voltage_scaling = get_short_circuit_voltage_scaling(opt)};
+                              .short_circuit_voltage_scaling = get_short_circuit_voltage_scaling(opt),
+                              .short_circuit_fault_scan = opt.short_circuit_fault_scan != 0,
+                              .state_estimation_tracking = opt.state_estimation_tracking != 0,
+                              .speculative_tap_search = opt.speculative_tap_search != 0,
+                              .tap_warm_start = opt.tap_warm_start != 0};
 }
 } // namespace
 
@@ -30,9 +30,21 @@ void PGM_set_short_circuit_voltage_scaling(PGM_Handle* /* handle */, PGM_Options
                                            PGM_Idx short_circuit_voltage_scaling) {
     opt->short_circuit_voltage_scaling = short_circuit_voltage_scaling;
 }
+void PGM_set_short_circuit_fault_scan(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx fault_scan) {
+    opt->short_circuit_fault_scan = fault_scan;
+}
 void PGM_set_tap_changing_strategy(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx tap_changing_strategy) {
     opt->tap_changing_strategy = tap_changing_strategy;
 }
+void PGM_set_state_estimation_tracking(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx tracking) {
+    opt->state_estimation_tracking = tracking;
+}
+void PGM_set_speculative_tap_search(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx speculative_tap_search) {
+    opt->speculative_tap_search = speculative_tap_search;
+}
+void PGM_set_tap_warm_start(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx tap_warm_start) {
+    opt->tap_warm_start = tap_warm_start;
+}
 void PGM_set_experimental_features(PGM_Handle* /* handle */, PGM_Options* opt, PGM_Idx experimental_features) {
     opt->experimental_features = experimental_features;
 }
@@ -24,6 +24,10 @@ struct PGM_Options {
     Idx max_iter{20};
     Idx threading{-1};
     Idx short_circuit_voltage_scaling{PGM_short_circuit_voltage_scaling_maximum};
+    Idx short_circuit_fault_scan{0};
     Idx tap_changing_strategy{PGM_tap_changing_strategy_disabled};
     Idx experimental_features{PGM_experimental_features_disabled};
+    Idx state_estimation_tracking{0};
+    Idx speculative_tap_search{0};
+    Idx tap_warm_start{0};
 };
@@ -14,6 +14,10 @@
 #include <power_grid_model/auxiliary/serialization/deserializer.hpp>
 #include <power_grid_model/auxiliary/serialization/serializer.hpp>
 
+#include <filesystem>
+#include <span>
+#include <string_view>
+
 using namespace power_grid_model::meta_data;
 
 PGM_Deserializer* PGM_create_deserializer_from_binary_buffer(PGM_Handle* handle, char const* data, PGM_Idx size,
@@ -41,14 +45,46 @@ PGM_Deserializer* PGM_create_deserializer_from_null_terminated_string(PGM_Handle
         PGM_serialization_error);
 }
 
+PGM_Deserializer* PGM_create_deserializer_from_file(PGM_Handle* handle, char const* file_path,
+                                                    PGM_Idx serialization_format) {
+    return call_with_catch(
+        handle,
+        [file_path, serialization_format] {
+            // the path is encoded in UTF-8
+            std::filesystem::path const path{std::u8string_view{reinterpret_cast<char8_t const*>(file_path)}};
+            return new PGM_Deserializer{from_file, path,
+                                        static_cast<power_grid_model::SerializationFormat>(serialization_format),
+                                        get_meta_data()};
+        },
+        PGM_serialization_error);
+}
+
 PGM_WritableDataset* PGM_deserializer_get_dataset(PGM_Handle* /*unused*/, PGM_Deserializer* deserializer) {
     return &deserializer->get_dataset_info();
 }
 
+void PGM_deserializer_set_threading(PGM_Handle* /*unused*/, PGM_Deserializer* deserializer, PGM_Idx threading) {
+    deserializer->set_threading(threading);
+}
+
 void PGM_deserializer_parse_to_buffer(PGM_Handle* handle, PGM_Deserializer* deserializer) {
     call_with_catch(handle, [deserializer] { deserializer->parse(); }, PGM_serialization_error);
 }
 
+void PGM_deserializer_select_scenarios(PGM_Handle* handle, PGM_Deserializer* deserializer, PGM_Idx first_scenario,
+                                       PGM_Idx n_scenarios) {
+    call_with_catch(
+        handle,
+        [deserializer, first_scenario, n_scenarios] { deserializer->select_scenarios(first_scenario, n_scenarios); },
+        PGM_serialization_error);
+}
+
+PGM_ConstDataset* PGM_deserializer_create_columnar_dataset(PGM_Handle* handle, PGM_Deserializer const* deserializer) {
+    return call_with_catch(
+        handle, [deserializer] { return new PGM_ConstDataset{deserializer->create_columnar_dataset()}; },
+        PGM_serialization_error);
+}
+
 // false warning from clang-tidy
 // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
 void PGM_destroy_deserializer(PGM_Deserializer* deserializer) { delete deserializer; }
@@ -86,4 +122,31 @@ char const* PGM_serializer_get_to_zero_terminated_string(PGM_Handle* handle, PGM
         PGM_serialization_error);
 }
 
+void PGM_serializer_write_to_callback(PGM_Handle* handle, PGM_Serializer* serializer, PGM_Idx use_compact_list,
+                                      PGM_Idx indent, PGM_WriteCallback callback, void* user_data) {
+    call_with_catch(
+        handle,
+        [serializer, use_compact_list, indent, callback, user_data] {
+            auto sink = [callback, user_data](std::span<char const> data) {
+                if (callback(user_data, data.data(), static_cast<PGM_Idx>(data.size())) != 0) {
+                    throw power_grid_model::SerializationError{"The write callback aborted the serialization.\n"};
+                }
+            };
+            serializer->write(sink, static_cast<bool>(use_compact_list), indent);
+        },
+        PGM_serialization_error);
+}
+
+void PGM_serializer_write_to_file(PGM_Handle* handle, PGM_Serializer* serializer, char const* file_path,
+                                  PGM_Idx use_compact_list, PGM_Idx indent) {
+    call_with_catch(
+        handle,
+        [serializer, file_path, use_compact_list, indent] {
+            // the path is encoded in UTF-8
+            std::filesystem::path const path{std::u8string_view{reinterpret_cast<char8_t const*>(file_path)}};
+            serializer->write_to_file(path, static_cast<bool>(use_compact_list), indent);
+        },
+        PGM_serialization_error);
+}
+
 void PGM_destroy_serializer(PGM_Serializer* serializer) { delete serializer; }
@@ -174,6 +174,10 @@ class DatasetConst {
         : dataset_{handle_.call_with(PGM_create_dataset_const_from_mutable, mutable_dataset.get())},
           info_{handle_.call_with(PGM_dataset_const_get_info, get())} {}
 
+    // take ownership of a dataset created by the C API
+    explicit DatasetConst(RawConstDataset* dataset)
+        : dataset_{dataset}, info_{handle_.call_with(PGM_dataset_const_get_info, get())} {}
+
     RawConstDataset const* get() const { return dataset_.get(); }
     RawConstDataset* get() { return dataset_.get(); }
 
@@ -13,6 +13,8 @@
 
 #include "power_grid_model_c/model.h"
 
+#include <vector>
+
 namespace power_grid_model_cpp {
 class Model {
   public:
@@ -54,6 +56,17 @@ class Model {
         handle_.call_with(PGM_calculate, get(), opt.get(), output_dataset.get(), nullptr);
     }
 
+    std::vector<char> get_topology_snapshot() {
+        char const* data{};
+        Idx size{};
+        handle_.call_with(PGM_get_topology_snapshot, get(), &data, &size);
+        return std::vector<char>(data, data + size);
+    }
+
+    void load_topology_snapshot(std::vector<char> const& data) {
+        handle_.call_with(PGM_load_topology_snapshot, get(), data.data(), static_cast<Idx>(data.size()));
+    }
+
   private:
     Handle handle_{};
     detail::UniquePtr<PowerGridModel, &PGM_destroy_model> model_;
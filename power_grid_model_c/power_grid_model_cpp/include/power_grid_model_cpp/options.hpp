@@ -35,10 +35,24 @@ class Options {
         handle_.call_with(PGM_set_short_circuit_voltage_scaling, get(), short_circuit_voltage_scaling);
     }
 
+    void set_short_circuit_fault_scan(Idx fault_scan) {
+        handle_.call_with(PGM_set_short_circuit_fault_scan, get(), fault_scan);
+    }
+
     void set_tap_changing_strategy(Idx tap_changing_strategy) {
         handle_.call_with(PGM_set_tap_changing_strategy, get(), tap_changing_strategy);
     }
 
+    void set_state_estimation_tracking(Idx tracking) {
+        handle_.call_with(PGM_set_state_estimation_tracking, get(), tracking);
+    }
+
+    void set_speculative_tap_search(Idx speculative_tap_search) {
+        handle_.call_with(PGM_set_speculative_tap_search, get(), speculative_tap_search);
+    }
+
+    void set_tap_warm_start(Idx tap_warm_start) { handle_.call_with(PGM_set_tap_warm_start, get(), tap_warm_start); }
+
     void set_experimental_features(Idx experimental_features) {
         handle_.call_with(PGM_set_experimental_features, get(), experimental_features);
     }
@@ -13,7 +13,11 @@
 
 #include "power_grid_model_c/serialization.h"
 
+#include <concepts>
 #include <cstring>
+#include <exception>
+#include <filesystem>
+#include <string_view>
 
 namespace power_grid_model_cpp {
 class Deserializer {
@@ -27,22 +31,53 @@ class Deserializer {
         : deserializer_{handle_.call_with(PGM_create_deserializer_from_binary_buffer, data.data(),
                                           static_cast<Idx>(data.size()), serialization_format)},
           dataset_{handle_.call_with(PGM_deserializer_get_dataset, get())} {}
+    Deserializer(char const* data_string, Idx serialization_format)
+        : deserializer_{handle_.call_with(PGM_create_deserializer_from_null_terminated_string, data_string,
+                                          serialization_format)},
+          dataset_{handle_.call_with(PGM_deserializer_get_dataset, get())} {}
     Deserializer(std::string const& data_string, Idx serialization_format)
         : deserializer_{handle_.call_with(PGM_create_deserializer_from_null_terminated_string, data_string.c_str(),
                                           serialization_format)},
           dataset_{handle_.call_with(PGM_deserializer_get_dataset, get())} {}
+    // the file is mapped into memory by the deserializer
+    // a named factory, as a path is implicitly constructed from a string with the data
+    static Deserializer from_file(std::filesystem::path const& file_path, Idx serialization_format) {
+        return Deserializer{from_file_t{}, file_path, serialization_format};
+    }
+    // a path is not taken as the data either, use from_file() instead
+    Deserializer(std::filesystem::path const& file_path, Idx serialization_format) = delete;
 
     RawDeserializer* get() { return deserializer_.get(); }
     RawDeserializer const* get() const { return deserializer_.get(); }
 
     DatasetWritable& get_dataset() { return dataset_; }
 
+    void set_threading(Idx threading) { handle_.call_with(PGM_deserializer_set_threading, get(), threading); }
+
     void parse_to_buffer() { handle_.call_with(PGM_deserializer_parse_to_buffer, get()); }
 
+    // the dataset info is updated to the selected scenarios, the buffers should be set again
+    void select_scenarios(Idx first_scenario, Idx n_scenarios) {
+        handle_.call_with(PGM_deserializer_select_scenarios, get(), first_scenario, n_scenarios);
+    }
+
+    // only for the columnar format, the dataset refers to the data of the deserializer and should not outlive it
+    DatasetConst create_columnar_dataset() const {
+        return DatasetConst{handle_.call_with(PGM_deserializer_create_columnar_dataset, get())};
+    }
+
   private:
+    struct from_file_t {};
+
     Handle handle_{};
     detail::UniquePtr<RawDeserializer, &PGM_destroy_deserializer> deserializer_;
     DatasetWritable dataset_;
+
+    Deserializer(from_file_t /* tag */, std::filesystem::path const& file_path, Idx serialization_format)
+        : deserializer_{handle_.call_with(PGM_create_deserializer_from_file,
+                                          reinterpret_cast<char const*>(file_path.u8string().c_str()),
+                                          serialization_format)},
+          dataset_{handle_.call_with(PGM_deserializer_get_dataset, get())} {}
 };
 
 class Serializer {
@@ -87,6 +122,40 @@ class Serializer {
             handle_.call_with(PGM_serializer_get_to_zero_terminated_string, get(), use_compact_list, indent)};
     }
 
+    // stream the serialized data to the sink in pieces of bounded size
+    // the sink is called with a std::string_view, which is only valid during the call
+    // an exception thrown by the sink aborts the serialization and is rethrown
+    template <std::invocable<std::string_view> Sink> void write(Sink& sink, Idx use_compact_list, Idx indent) {
+        struct SinkContext {
+            Sink* sink;
+            std::exception_ptr exception;
+        } context{&sink, nullptr};
+        auto const callback = [](void* user_data, char const* data, Idx size) noexcept -> Idx {
+            auto& ctx = *static_cast<SinkContext*>(user_data);
+            try {
+                (*ctx.sink)(std::string_view{data, static_cast<size_t>(size)});
+                return 0;
+            } catch (...) {
+                ctx.exception = std::current_exception();
+                return 1;
+            }
+        };
+        try {
+            handle_.call_with(PGM_serializer_write_to_callback, get(), use_compact_list, indent,
+                              static_cast<PGM_WriteCallback>(callback), static_cast<void*>(&context));
+        } catch (PowerGridError const&) {
+            if (context.exception) {
+                std::rethrow_exception(context.exception);
+            }
+            throw;
+        }
+    }
+
+    void write_to_file(std::filesystem::path const& file_path, Idx use_compact_list, Idx indent) {
+        handle_.call_with(PGM_serializer_write_to_file, get(),
+                          reinterpret_cast<char const*>(file_path.u8string().c_str()), use_compact_list, indent);
+    }
+
   private:
     power_grid_model_cpp::Handle handle_{};
     detail::UniquePtr<RawSerializer, &PGM_destroy_serializer> serializer_;
@@ -42,6 +42,7 @@ class Options:
     threading = OptionSetter(pgc.set_threading)
     tap_changing_strategy = OptionSetter(pgc.set_tap_changing_strategy)
     short_circuit_voltage_scaling = OptionSetter(pgc.set_short_circuit_voltage_scaling)
+    short_circuit_fault_scan = OptionSetter(pgc.set_short_circuit_fault_scan)
     experimental_features = OptionSetter(pgc.set_experimental_features)
 
     @property
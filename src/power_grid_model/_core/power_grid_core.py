@@ -350,6 +350,10 @@ class PowerGridCore:
     ) -> None:  # type: ignore[empty-body]
         pass  # pragma: no cover
 
+    @make_c_binding
+    def set_short_circuit_fault_scan(self, opt: OptionsPtr, fault_scan: int) -> None:  # type: ignore[empty-body]
+        pass  # pragma: no cover
+
     @make_c_binding
     def set_experimental_features(
         self, opt: OptionsPtr, experimental_features: int
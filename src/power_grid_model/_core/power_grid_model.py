@@ -387,6 +387,7 @@ class PowerGridModel:
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
         short_circuit_voltage_scaling: ShortCircuitVoltageScaling | str = ShortCircuitVoltageScaling.maximum,
+        fault_scan: bool = False,
         experimental_features: _ExperimentalFeatures | str = _ExperimentalFeatures.disabled,
     ) -> dict[ComponentType, np.ndarray]:
         calculation_type = CalculationType.short_circuit
@@ -398,6 +399,7 @@ class PowerGridModel:
             calculation_method=calculation_method,
             threading=threading,
             short_circuit_voltage_scaling=short_circuit_voltage_scaling,
+            short_circuit_fault_scan=int(fault_scan),
             experimental_features=experimental_features,
         )
         return self._calculate_impl(
@@ -614,6 +616,7 @@ class PowerGridModel:
         continue_on_batch_error: bool = False,
         decode_error: bool = True,
         short_circuit_voltage_scaling: ShortCircuitVoltageScaling | str = ShortCircuitVoltageScaling.maximum,
+        fault_scan: bool = False,
     ) -> dict[ComponentType, np.ndarray]:
         """
         Calculate a short circuit once with the current model attributes.
@@ -663,6 +666,11 @@ class PowerGridModel:
             short_circuit_voltage_scaling ({ShortCircuitVoltageSaling, str}, optional):
                 Whether to use the maximum or minimum voltage scaling.
                 By default, the maximum voltage scaling is used to calculate the short circuit.
+            fault_scan (bool, optional):
+                Also calculate the currents of a bolted fault at every node, as if each node were faulted on its own.
+                The network is factorized only once for all nodes.
+                The results are in the i_f_three_phase and i_f_single_phase attributes of the node output.
+                By default, no fault scan is done.
 
         Returns:
             Dictionary of results of all components.
@@ -686,6 +694,7 @@ class PowerGridModel:
             continue_on_batch_error=continue_on_batch_error,
             decode_error=decode_error,
             short_circuit_voltage_scaling=short_circuit_voltage_scaling,
+            fault_scan=fault_scan,
         )
 
     def __del__(self):
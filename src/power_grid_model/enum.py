@@ -90,6 +90,10 @@ class TapChangingStrategy(IntEnum):
     """
     Adjust tap position automatically; optimize for any value in the voltage band; binary search
     """
+    sensitivity_any_tap = 5
+    """
+    Adjust tap position automatically; optimize for any value in the voltage band; sensitivity search
+    """
 
 
 class MeasuredTerminalType(IntEnum):
@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+// Issue in msgpack, reported in https://github.com/msgpack/msgpack-c/issues/1098
+// May be a Clang Analyzer bug
+#ifndef __clang_analyzer__ // TODO(mgovers): re-enable this when issue in msgpack is fixed
+
+#include <power_grid_model/auxiliary/meta_data_gen.hpp>
+#include <power_grid_model/auxiliary/serialization/columnar_format.hpp>
+#include <power_grid_model/auxiliary/serialization/deserializer.hpp>
+#include <power_grid_model/auxiliary/serialization/serializer.hpp>
+#include <power_grid_model/auxiliary/update.hpp>
+#include <power_grid_model/component/load_gen.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace power_grid_model::meta_data {
+
+namespace {
+constexpr std::string_view json_batch = R"(
+{
+  "version": "1.0",
+  "type": "update",
+  "is_batch": true,
+  "attributes": {"sym_load": ["id", "p_specified"]},
+  "data": [
+    {"sym_load": [[7, 1.0]], "asym_load": [{"id": 9, "p_specified": [1.0, 2.0, 3.0]}]},
+    {"asym_load": [{"id": 9, "q_specified": [4.0, "inf", null]}]},
+    {"sym_load": [[7, 2.0], {"id": 8, "status": 0}], "asym_load": [{"id": 9}]},
+    {"sym_load": [[37, "-inf"]], "asym_load": [{"id": 31, "p_specified": [5.0, 6.0, 7.0]}]}
+  ]
+}
+)";
+
+struct BatchData {
+    std::vector<SymLoadGenUpdate> sym_load;
+    IdxVector sym_load_indptr;
+    std::vector<AsymLoadGenUpdate> asym_load;
+};
+
+BatchData parse(Deserializer& deserializer) {
+    BatchData result;
+    auto& info = deserializer.get_dataset_info();
+    result.sym_load.resize(info.get_component_info("sym_load").total_elements);
+    result.sym_load_indptr.resize(info.batch_size() + 1);
+    result.asym_load.resize(info.get_component_info("asym_load").total_elements);
+    info.set_buffer("sym_load", result.sym_load_indptr.data(), result.sym_load.data());
+    info.set_buffer("asym_load", nullptr, result.asym_load.data());
+    deserializer.parse();
+    return result;
+}
+
+// compare the bytes of all attributes, nan included, the padding is not compared
+template <class T>
+bool attributes_equal(std::vector<T> const& x, std::vector<T> const& y, std::string_view component_name) {
+    if (x.size() != y.size()) {
+        return false;
+    }
+    auto const& component = meta_data_gen::meta_data.get_dataset("update").get_component(component_name);
+    return std::ranges::all_of(IdxRange{static_cast<Idx>(x.size())}, [&](Idx idx) {
+        return std::ranges::all_of(component.attributes, [&](MetaAttribute const& attribute) {
+            return std::memcmp(reinterpret_cast<char const*>(&x[idx]) + attribute.offset,
+                               reinterpret_cast<char const*>(&y[idx]) + attribute.offset, attribute.size) == 0;
+        });
+    });
+}
+
+std::vector<char> to_columnar(ConstDataset const& dataset) {
+    Serializer serializer{dataset, SerializationFormat::columnar};
+    auto const buffer = serializer.get_binary_buffer(false);
+    return {buffer.begin(), buffer.end()};
+}
+} // namespace
+
+TEST_CASE("Columnar format") {
+    Deserializer json_deserializer{from_json, json_batch, meta_data_gen::meta_data};
+    BatchData const reference = parse(json_deserializer);
+    ConstDataset const reference_dataset{json_deserializer.get_dataset_info()};
+    std::vector<char> const columnar_data = to_columnar(reference_dataset);
+
+    SUBCASE("Layout") {
+        CHECK(columnar_data.size() % columnar_format::alignment == 0);
+        CHECK(std::memcmp(columnar_data.data(), columnar_format::magic.data(), columnar_format::magic.size()) == 0);
+
+        columnar_format::Reader const reader{columnar_data, meta_data_gen::meta_data};
+        CHECK(reader.is_batch());
+        CHECK(reader.batch_size() == 4);
+        CHECK(std::string_view{reader.dataset().name} == "update");
+        REQUIRE(reader.components().size() == 2);
+        for (auto const& component : reader.components()) {
+            for (auto const& attribute : component.attributes) {
+                CHECK((attribute.data - columnar_data.data()) % columnar_format::alignment == 0);
+            }
+        }
+        // only the attributes with values are stored
+        auto const& sym_load = reader.components()[0];
+        CHECK(std::string_view{sym_load.component->name} == "sym_load");
+        CHECK(sym_load.elements_per_scenario == -1);
+        CHECK(sym_load.indptr == IdxVector{0, 1, 1, 3, 4});
+        CHECK(sym_load.attributes.size() == 3); // id, status, p_specified
+        auto const& asym_load = reader.components()[1];
+        CHECK(asym_load.elements_per_scenario == 1);
+        CHECK(asym_load.attributes.size() == 3); // id, p_specified, q_specified
+    }
+
+    SUBCASE("Round trip") {
+        Deserializer deserializer{from_buffer, columnar_data, SerializationFormat::columnar,
+                                  meta_data_gen::meta_data};
+        auto const& info = deserializer.get_dataset_info();
+        CHECK(info.batch_size() == 4);
+        CHECK(info.get_component_info("sym_load").has_attribute_indications);
+        CHECK(info.get_component_info("sym_load").attribute_indications.size() == 3);
+        BatchData const result = parse(deserializer);
+        CHECK(result.sym_load_indptr == reference.sym_load_indptr);
+        CHECK(attributes_equal(result.sym_load, reference.sym_load, "sym_load"));
+        CHECK(attributes_equal(result.asym_load, reference.asym_load, "asym_load"));
+
+        // the same bytes are written again
+        CHECK(to_columnar(ConstDataset{deserializer.get_dataset_info()}) == columnar_data);
+    }
+
+    SUBCASE("Columnar buffers and selected scenarios") {
+        Deserializer deserializer{from_buffer, columnar_data, SerializationFormat::columnar,
+                                  meta_data_gen::meta_data};
+        deserializer.select_scenarios(2, 2);
+        auto& info = deserializer.get_dataset_info();
+        REQUIRE(info.get_component_info("sym_load").total_elements == 3);
+        std::vector<ID> id(3);
+        std::vector<double> p_specified(3);
+        IdxVector indptr(3);
+        info.set_buffer("sym_load", indptr.data(), nullptr);
+        info.set_attribute_buffer("sym_load", "id", id.data());
+        info.set_attribute_buffer("sym_load", "p_specified", p_specified.data());
+        deserializer.parse();
+        CHECK(indptr == IdxVector{0, 2, 3});
+        CHECK(id == std::vector<ID>{7, 8, 37});
+        CHECK(p_specified[0] == 2.0);
+        CHECK(is_nan(p_specified[1]));
+        CHECK(p_specified[2] == -std::numeric_limits<double>::infinity());
+    }
+
+    SUBCASE("In place from file") {
+        auto const file_path = std::filesystem::temp_directory_path() / "pgm_test_columnar_format.pgmc";
+        {
+            Serializer serializer{reference_dataset, SerializationFormat::columnar};
+            serializer.write_to_file(file_path, false, -1);
+        }
+        {
+            Deserializer deserializer{from_file, file_path, SerializationFormat::columnar, meta_data_gen::meta_data};
+            ConstDataset const dataset = deserializer.create_columnar_dataset();
+            CHECK(dataset.batch_size() == 4);
+            CHECK(dataset.is_columnar("sym_load"));
+            auto const sym_load = dataset.get_columnar_buffer_span_all_scenarios<update_getter_s, SymLoad>();
+            REQUIRE(sym_load.size() == 4);
+            CHECK(sym_load[2].size() == 2);
+            CHECK(sym_load[2][1].get().id == 8);
+            CHECK(sym_load[2][1].get().status == 0);
+            auto const asym_load = dataset.get_columnar_buffer_span<update_getter_s, AsymLoad>();
+            REQUIRE(asym_load.size() == 4);
+            for (Idx idx = 0; idx != 4; ++idx) {
+                std::vector<AsymLoadGenUpdate> const value{asym_load[idx].get()};
+                CHECK(attributes_equal(value, {reference.asym_load[idx]}, "asym_load"));
+            }
+        }
+        std::filesystem::remove(file_path);
+    }
+
+    SUBCASE("Only the columnar format can be used in place") {
+        CHECK_THROWS_AS(json_deserializer.create_columnar_dataset(), SerializationError);
+    }
+
+    SUBCASE("Invalid data") {
+        auto const check_invalid = [](std::vector<char> const& data) {
+            CHECK_THROWS_AS((Deserializer{from_buffer, data, SerializationFormat::columnar, meta_data_gen::meta_data}),
+                            SerializationError);
+        };
+        check_invalid({});
+        check_invalid({columnar_data.begin(), columnar_data.end() - columnar_format::alignment});
+
+        auto wrong_magic = columnar_data;
+        wrong_magic[0] = 'X';
+        check_invalid(wrong_magic);
+
+        auto wrong_version = columnar_data;
+        wrong_version[columnar_format::magic.size()] = 2;
+        check_invalid(wrong_version);
+
+        auto wrong_name = columnar_data;
+        Idx dataset_name_offset{};
+        std::memcpy(&dataset_name_offset, wrong_name.data() + 40, sizeof(Idx));
+        wrong_name[dataset_name_offset] = 'X';
+        check_invalid(wrong_name);
+    }
+}
+
+} // namespace power_grid_model::meta_data
+
+#endif // __clang_analyzer__ // issue in msgpack
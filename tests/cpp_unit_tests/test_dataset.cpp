@@ -256,6 +256,21 @@ TEST_CASE_TEMPLATE("Test range object", RangeObjectType, const_range_object<A::I
         check_buffer(range_object);
     }
 
+    SUBCASE("Copy to rows") {
+        std::vector<A::InputType> rows(range_object.size());
+        range_object.copy_to(rows);
+        for (Idx idx = 0; idx < range_object.size(); ++idx) {
+            test::check_equal(rows[idx], range_object[idx]);
+        }
+
+        RangeObjectType const sub_range{range_object.begin() + 1, range_object.end()};
+        std::vector<A::InputType> sub_rows(sub_range.size());
+        sub_range.copy_to(sub_rows);
+        for (Idx idx = 0; idx < sub_range.size(); ++idx) {
+            test::check_equal(sub_rows[idx], range_object[idx + 1]);
+        }
+    }
+
     if constexpr (std::same_as<RangeObjectType, mutable_range_object<A::InputType>>) {
         SUBCASE("Write access") {
             A::InputType const new_values{.id = 20, .a0 = -10.0, .a1 = nan};
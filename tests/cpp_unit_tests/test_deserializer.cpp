@@ -13,9 +13,21 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 namespace power_grid_model::meta_data {
 
 using namespace std::string_literals;
+using namespace std::string_view_literals;
 
 // single data
 namespace {
@@ -264,6 +276,27 @@ void check_error(std::string_view json, char const* err_msg) {
     CHECK_THROWS_WITH_AS(run(), doctest::Contains(err_msg), std::exception);
 }
 
+// compare per attribute, as the padding bytes of the structs are not defined
+template <symmetry_tag sym>
+void check_equal(std::vector<LoadGenUpdate<sym>> const& actual, std::vector<LoadGenUpdate<sym>> const& expected) {
+    auto const check_value = [](double x, double y) { CHECK((x == y || (is_nan(x) && is_nan(y)))); };
+    REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i != actual.size(); ++i) {
+        CAPTURE(i);
+        CHECK(actual[i].id == expected[i].id);
+        CHECK(actual[i].status == expected[i].status);
+        if constexpr (is_symmetric_v<sym>) {
+            check_value(actual[i].p_specified, expected[i].p_specified);
+            check_value(actual[i].q_specified, expected[i].q_specified);
+        } else {
+            for (Idx phase = 0; phase != 3; ++phase) {
+                check_value(actual[i].p_specified(phase), expected[i].p_specified(phase));
+                check_value(actual[i].q_specified(phase), expected[i].q_specified(phase));
+            }
+        }
+    }
+}
+
 } // namespace
 
 TEST_CASE("Deserializer") {
@@ -580,7 +613,296 @@ TEST_CASE("Deserializer") {
     }
 }
 
+TEST_CASE("Deserializer reads json directly or through msgpack") {
+    // json with escape sequences is converted to msgpack instead of being read directly
+    std::string const json_with_escape = R"({"comment": "escaped \" quote",)" + std::string{json_batch.substr(3)};
+
+    auto const parse = [](std::string_view json) {
+        std::pair<std::vector<SymLoadGenUpdate>, std::vector<AsymLoadGenUpdate>> result;
+        Deserializer deserializer{from_json, json, meta_data_gen::meta_data};
+        auto& info = deserializer.get_dataset_info();
+        result.first.resize(info.get_component_info("sym_load").total_elements);
+        result.second.resize(info.get_component_info("asym_load").total_elements);
+        std::vector<Idx> sym_load_indptr(info.batch_size() + 1);
+        info.set_buffer("sym_load", sym_load_indptr.data(), result.first.data());
+        info.set_buffer("asym_load", nullptr, result.second.data());
+        deserializer.parse();
+        return result;
+    };
+
+    auto const [sym_load, asym_load] = parse(json_batch);
+    auto const [sym_load_escape, asym_load_escape] = parse(json_with_escape);
+    check_equal(sym_load_escape, sym_load);
+    check_equal(asym_load_escape, asym_load);
+
+    SUBCASE("The json can be released after construction") {
+        auto json = std::make_unique<std::string>(json_batch);
+        Deserializer deserializer{from_json, *json, meta_data_gen::meta_data};
+        std::ranges::fill(*json, ' ');
+        json.reset();
+
+        auto& info = deserializer.get_dataset_info();
+        std::vector<SymLoadGenUpdate> sym_load_released(info.get_component_info("sym_load").total_elements);
+        std::vector<AsymLoadGenUpdate> asym_load_released(info.get_component_info("asym_load").total_elements);
+        std::vector<Idx> sym_load_indptr(info.batch_size() + 1);
+        info.set_buffer("sym_load", sym_load_indptr.data(), sym_load_released.data());
+        info.set_buffer("asym_load", nullptr, asym_load_released.data());
+        deserializer.parse();
+
+        check_equal(sym_load_released, sym_load);
+        check_equal(asym_load_released, asym_load);
+    }
+}
+
+TEST_CASE("Deserializer with predefined attributes in any order") {
+    // the attributes in the default order are parsed by the generated kernel of the component,
+    // the attributes in another order by the generic path
+    auto const parse = [](std::string_view attributes, std::string_view elements) {
+        std::string const json =
+            R"({"version": "1.0", "type": "update", "is_batch": false, "attributes": {"sym_load": )"s +
+            std::string{attributes} + R"(}, "data": {"sym_load": )"s + std::string{elements} + "}}"s;
+        Deserializer deserializer{from_json, json, meta_data_gen::meta_data};
+        std::vector<SymLoadGenUpdate> sym_load(2);
+        deserializer.get_dataset_info().set_buffer("sym_load", nullptr, sym_load.data());
+        deserializer.parse();
+        return sym_load;
+    };
+
+    auto const default_order = parse(R"(["id", "status", "p_specified"])", "[[5, 0, 1.0], [6, 1, null]]");
+    CHECK(default_order[0].id == 5);
+    CHECK(default_order[0].status == 0);
+    CHECK(default_order[0].p_specified == 1.0);
+    CHECK(is_nan(default_order[0].q_specified));
+    CHECK(default_order[1].id == 6);
+    CHECK(default_order[1].status == 1);
+    CHECK(is_nan(default_order[1].p_specified));
+
+    auto const other_order = parse(R"(["p_specified", "id", "status"])", "[[1.0, 5, 0], [null, 6, 1]]");
+    check_equal(other_order, default_order);
+
+    // the position of an error is reported in the same way
+    for (auto const attributes : {R"(["id", "status", "p_specified"])"sv, R"(["status", "id", "p_specified"])"sv}) {
+        CHECK_THROWS_WITH_AS(parse(attributes, R"([[5, 0, 1.0], [6, 1, "wrong"]])"),
+                             doctest::Contains("Position of error: data/sym_load/1/2"), SerializationError);
+    }
+}
+
+TEST_CASE("Deserializer skips the data that is not requested") {
+    // msgpack with additional user info of all kinds of types next to the data
+    msgpack::sbuffer msgpack_data;
+    msgpack::packer packer{msgpack_data};
+    auto const pack_user_info = [&packer, &msgpack_data]() {
+        packer.pack_map(4);
+        packer.pack("comment"s);
+        packer.pack(std::string(300, 'x')); // str 16
+        packer.pack("blob"s);
+        msgpack_data.write("\xc4\x03" "abc", 5); // bin 8
+        packer.pack("ext"s);
+        msgpack_data.write("\xc7\x05\x01" "abcde", 8); // ext 8
+        packer.pack("nested"s);
+        packer.pack_array(20); // array 16
+        for (int64_t i = 0; i != 20; ++i) {
+            packer.pack(std::map<std::string, int64_t>{{"a", i * 1000000}, {"b", -i}});
+        }
+    };
+    packer.pack_map(6);
+    packer.pack("version"s);
+    packer.pack("1.0"s);
+    packer.pack("type"s);
+    packer.pack("update"s);
+    packer.pack("is_batch"s);
+    packer.pack(false);
+    packer.pack("attributes"s);
+    packer.pack(std::map<std::string, std::vector<std::string>>{{"sym_load", {"id", "p_specified", "q_specified"}}});
+    packer.pack("user_info"s);
+    pack_user_info();
+    packer.pack("data"s);
+    packer.pack_map(2);
+    packer.pack("sym_load"s);
+    packer.pack_array(2);
+    packer.pack_array(3);
+    packer.pack(int32_t{1});
+    packer.pack(1.0);
+    packer.pack(2.0);
+    packer.pack_map(3);
+    packer.pack("id"s);
+    packer.pack(int32_t{2});
+    packer.pack("user_info"s);
+    pack_user_info();
+    packer.pack("p_specified"s);
+    packer.pack(3.0);
+    packer.pack("asym_load"s);
+    packer.pack_array(1);
+    packer.pack(std::map<std::string, int32_t>{{"id", 3}});
+
+    std::span<char const> const data{msgpack_data.data(), msgpack_data.size()};
+
+    SUBCASE("Only the requested attribute") {
+        Deserializer deserializer{from_msgpack, data, meta_data_gen::meta_data};
+        auto& info = deserializer.get_dataset_info();
+        REQUIRE(info.get_component_info("sym_load").total_elements == 2);
+        REQUIRE(info.get_component_info("asym_load").total_elements == 1);
+        std::vector<double> p_specified(2);
+        info.set_buffer("sym_load", nullptr, nullptr);
+        info.set_attribute_buffer("sym_load", "p_specified", p_specified.data());
+        deserializer.parse();
+        CHECK(p_specified == std::vector<double>{1.0, 3.0});
+    }
+
+    SUBCASE("Truncated user info") {
+        // cut the data in the middle of the nested user info of the second element
+        auto const truncated = data.first(data.size() - 40);
+        CHECK_THROWS_AS((Deserializer{from_msgpack, truncated, meta_data_gen::meta_data}), SerializationError);
+    }
+
+    SUBCASE("Skip a single value") {
+        for (std::string_view const value : {"\x93\x01\xc0\xa2" "ab"sv, "\xde\x00\x01\xc3\xd9\x01x"sv}) {
+            size_t offset{};
+            CHECK_NOTHROW(detail::skip_msgpack_value(value.data(), value.size(), offset));
+            CHECK(offset == value.size());
+            offset = 0;
+            CHECK_THROWS_AS(detail::skip_msgpack_value(value.data(), value.size() - 1, offset), SerializationError);
+        }
+        size_t offset{};
+        CHECK(detail::skip_msgpack_value("\x91\x80", 2, offset)); // map in the array
+        offset = 0;
+        CHECK_THROWS_AS(detail::skip_msgpack_value("\xc1", 1, offset), SerializationError);
+    }
+}
+
+TEST_CASE("Deserializer parses in parallel") {
+    auto const parse = [](Idx threading) {
+        std::pair<std::vector<SymLoadGenUpdate>, std::vector<AsymLoadGenUpdate>> result;
+        Deserializer deserializer{from_json, json_batch, meta_data_gen::meta_data};
+        deserializer.set_threading(threading);
+        auto& info = deserializer.get_dataset_info();
+        result.first.resize(info.get_component_info("sym_load").total_elements);
+        result.second.resize(info.get_component_info("asym_load").total_elements);
+        IdxVector sym_load_indptr(info.batch_size() + 1);
+        info.set_buffer("sym_load", sym_load_indptr.data(), result.first.data());
+        info.set_buffer("asym_load", nullptr, result.second.data());
+        deserializer.parse();
+        CHECK(sym_load_indptr == IdxVector{0, 1, 1, 3, 4});
+        return result;
+    };
+
+    auto const [sym_load, asym_load] = parse(-1);
+    for (Idx const threading : {0, 2, 3, 4, 8}) {
+        CAPTURE(threading);
+        auto const [sym_load_parallel, asym_load_parallel] = parse(threading);
+        check_equal(sym_load_parallel, sym_load);
+        check_equal(asym_load_parallel, asym_load);
+    }
+
+    SUBCASE("Error in one of the threads") {
+        constexpr std::string_view wrong_type =
+            R"({"version": "1.0", "type": "input", "is_batch": true, "attributes": {}, "data": [{"node": [{"id": 1}]},
+{"node": [{"id": 2}]}, {"node": [{"id": true}]}, {"node": [{"id": 4}]}]})";
+        Deserializer deserializer{from_json, wrong_type, meta_data_gen::meta_data};
+        deserializer.set_threading(2);
+        std::vector<NodeInput> node(4);
+        deserializer.get_dataset_info().set_buffer("node", nullptr, node.data());
+        CHECK_THROWS_WITH_AS(deserializer.parse(), doctest::Contains("Position of error: data/2/node/0/id"),
+                             SerializationError);
+    }
+}
+
+TEST_CASE("Deserializer with selected scenarios") {
+    Deserializer deserializer{from_json, json_batch, meta_data_gen::meta_data};
+
+    SUBCASE("Parse a chunk of scenarios") {
+        deserializer.select_scenarios(2, 2);
+        auto& info = deserializer.get_dataset_info();
+        CHECK(info.is_batch());
+        CHECK(info.batch_size() == 2);
+        CHECK(info.get_component_info("sym_load").elements_per_scenario == -1);
+        CHECK(info.get_component_info("sym_load").total_elements == 3);
+        CHECK(info.get_component_info("asym_load").elements_per_scenario == 1);
+        CHECK(info.get_component_info("asym_load").total_elements == 2);
+
+        std::vector<SymLoadGenUpdate> sym_load(3);
+        std::vector<AsymLoadGenUpdate> asym_load(2);
+        IdxVector sym_load_indptr(3);
+        info.set_buffer("sym_load", sym_load_indptr.data(), sym_load.data());
+        info.set_buffer("asym_load", nullptr, asym_load.data());
+        deserializer.parse();
+
+        CHECK(sym_load_indptr == IdxVector{0, 2, 3});
+        CHECK(sym_load[0].id == 7);
+        CHECK(sym_load[0].q_specified == doctest::Approx(10.0));
+        CHECK(sym_load[1].id == 8);
+        CHECK(sym_load[1].status == 0);
+        CHECK(sym_load[2].id == 37);
+        CHECK(asym_load[0].id == 9);
+        CHECK(asym_load[0].q_specified(1) == doctest::Approx(80.0));
+        CHECK(asym_load[1].id == 31);
+        CHECK(asym_load[1].p_specified(1) == doctest::Approx(75.0));
+    }
+
+    SUBCASE("Parse all chunks one by one") {
+        std::vector<ID> sym_load_id;
+        std::vector<ID> asym_load_id;
+        for (Idx first_scenario = 0; first_scenario != 4; ++first_scenario) {
+            deserializer.select_scenarios(first_scenario, 1);
+            auto& info = deserializer.get_dataset_info();
+            CHECK(info.batch_size() == 1);
+            std::vector<SymLoadGenUpdate> sym_load(info.get_component_info("sym_load").total_elements);
+            std::vector<AsymLoadGenUpdate> asym_load(info.get_component_info("asym_load").total_elements);
+            info.set_buffer("sym_load", nullptr, sym_load.data());
+            info.set_buffer("asym_load", nullptr, asym_load.data());
+            deserializer.parse();
+            std::ranges::transform(sym_load, std::back_inserter(sym_load_id), [](auto const& x) { return x.id; });
+            std::ranges::transform(asym_load, std::back_inserter(asym_load_id), [](auto const& x) { return x.id; });
+        }
+        CHECK(sym_load_id == std::vector<ID>{7, 7, 8, 37});
+        CHECK(asym_load_id == std::vector<ID>{9, 9, 9, 31});
+    }
+
+    SUBCASE("Out of range") {
+        CHECK_THROWS_AS(deserializer.select_scenarios(3, 2), SerializationError);
+        CHECK_THROWS_AS(deserializer.select_scenarios(-1, 1), SerializationError);
+        CHECK(deserializer.get_dataset_info().batch_size() == 4);
+    }
+}
+
+TEST_CASE("Deserializer from file") {
+    auto const file_path = std::filesystem::temp_directory_path() / "pgm_test_deserializer_from_file.json";
+    // the json is read in place from the mapping, or converted to msgpack if it has escape sequences
+    std::string const json_with_escape = R"({"comment": "escaped \" quote",)" + std::string{json_batch.substr(3)};
+    for (std::string_view const json : {json_batch, std::string_view{json_with_escape}}) {
+        {
+            std::ofstream file{file_path, std::ios::binary};
+            file << json;
+        }
+        Deserializer deserializer{from_file, file_path, SerializationFormat::json, meta_data_gen::meta_data};
+        auto& info = deserializer.get_dataset_info();
+        CHECK(info.batch_size() == 4);
+        std::vector<SymLoadGenUpdate> sym_load(4);
+        std::vector<AsymLoadGenUpdate> asym_load(4);
+        IdxVector sym_load_indptr(5);
+        info.set_buffer("sym_load", sym_load_indptr.data(), sym_load.data());
+        info.set_buffer("asym_load", nullptr, asym_load.data());
+        deserializer.parse();
+        CHECK(sym_load_indptr == IdxVector{0, 1, 1, 3, 4});
+        CHECK(sym_load[3].id == 37);
+        CHECK(asym_load[3].id == 31);
+    }
+    std::filesystem::remove(file_path);
+
+    CHECK_THROWS_AS((Deserializer{from_file, file_path, SerializationFormat::json, meta_data_gen::meta_data}),
+                    SerializationError);
+}
+
 TEST_CASE("Deserializer with error") {
+    SUBCASE("Error in json") {
+        constexpr std::string_view syntax_error = R"({"version": })";
+        check_error(syntax_error, "Parse error in JSON");
+        constexpr std::string_view trailing_data = R"({"version": "1.0"} {})";
+        check_error(trailing_data, "Parse error in JSON");
+        constexpr std::string_view root_array = R"([{"version": "1.0"}])";
+        check_error(root_array, "Json root should be a map");
+    }
+
     SUBCASE("Error in meta data") {
         constexpr std::string_view no_version = R"({})";
         check_error(no_version, "version");
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/id_index.hpp>
+
+#include <doctest/doctest.h>
+
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace power_grid_model {
+
+namespace {
+void check_entries(IdIndex const& index, std::vector<ID> const& ids) {
+    CHECK(index.size() == static_cast<Idx>(ids.size()));
+    for (Idx i = 0; i != static_cast<Idx>(ids.size()); ++i) {
+        CHECK(index.find(ids[i]) == Idx2D{.group = i % 3, .pos = i});
+        CHECK(index.contains(ids[i]));
+        CHECK(index.find_id(Idx2D{.group = i % 3, .pos = i}) == ids[i]);
+    }
+}
+} // namespace
+
+TEST_CASE("Test ID index") {
+    IdIndex index;
+    CHECK(index.size() == 0);
+    CHECK(index.find(1) == IdIndex::not_found);
+    CHECK(!index.contains(1));
+
+    SUBCASE("Dense IDs") {
+        std::vector<ID> ids(100);
+        std::iota(ids.begin(), ids.end(), -10);
+        ids[50] = 200; // gap in the ID range
+        for (Idx i = 0; i != static_cast<Idx>(ids.size()); ++i) {
+            CHECK(index.emplace(ids[i], Idx2D{.group = i % 3, .pos = i}));
+        }
+        CHECK(!index.emplace(5, Idx2D{.group = 0, .pos = 0}));
+        check_entries(index, ids);
+
+        index.compact();
+        check_entries(index, ids);
+        CHECK(index.find(-11) == IdIndex::not_found);
+        CHECK(index.find(150) == IdIndex::not_found);
+        CHECK(index.find(201) == IdIndex::not_found);
+        CHECK(!index.find_id(Idx2D{.group = 5, .pos = 0}).has_value());
+
+        SUBCASE("Insert after compaction") {
+            CHECK(!index.emplace(200, Idx2D{.group = 0, .pos = 0}));
+            CHECK(index.emplace(1000, Idx2D{.group = 100 % 3, .pos = 100}));
+            ids.push_back(1000);
+            check_entries(index, ids);
+        }
+    }
+
+    SUBCASE("Sparse IDs") {
+        std::vector<ID> ids;
+        for (ID id = std::numeric_limits<ID>::min(); ids.size() != 1000; id += 4'000'000) {
+            ids.push_back(id);
+        }
+        index.reserve(static_cast<Idx>(ids.size()));
+        for (Idx i = 0; i != static_cast<Idx>(ids.size()); ++i) {
+            CHECK(index.emplace(ids[i], Idx2D{.group = i % 3, .pos = i}));
+        }
+        CHECK(!index.emplace(ids[10], Idx2D{.group = 0, .pos = 0}));
+        check_entries(index, ids);
+
+        index.compact();
+        check_entries(index, ids);
+        CHECK(index.find(1) == IdIndex::not_found);
+        CHECK(index.find(std::numeric_limits<ID>::max()) == IdIndex::not_found);
+    }
+}
+
+} // namespace power_grid_model
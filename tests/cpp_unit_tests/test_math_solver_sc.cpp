@@ -451,6 +451,129 @@ TEST_CASE("Short circuit solver") {
             auto output = solver.run_short_circuit(y_bus_asym, sc_input);
             assert_sc_output<asymmetric_t>(output, sc_output_ref);
         }
+
+        SUBCASE("Source with zero sequence impedance on solid ground faults") {
+            // the mutual admittance between the phases of the source should only be counted once
+            DoubleComplex const yref_0{yref / 3.0};
+            DoubleComplex const zref_0{1.0 / yref_0};
+            MathModelParam<asymmetric_t> asym_param_z0;
+            asym_param_z0.source_param = {SourceCalcParam{.y1 = yref, .y0 = yref_0}};
+            auto asym_param_z0_ptr = std::make_shared<MathModelParam<asymmetric_t> const>(asym_param_z0);
+            YBus<asymmetric_t> const y_bus_z0{topo_comp_ptr, asym_param_z0_ptr};
+            ShortCircuitSolver<asymmetric_t> solver_z0{y_bus_z0, topo_comp_ptr};
+
+            SUBCASE("Source on 1phg solid fault") {
+                DoubleComplex const if_1phg = 3.0 * vref / (2.0 * zref + zref_0);
+                ComplexValue<asymmetric_t> const if_ref{if_1phg, 0.0, 0.0};
+
+                auto sc_input =
+                    create_sc_test_input(single_phase_to_ground, FaultPhase::a, y_fault_solid, vref, fault_buses_2);
+                auto output = solver_z0.run_short_circuit(y_bus_z0, sc_input);
+                check_close<asymmetric_t>(output.fault[0].i_fault, if_ref, numerical_tolerance);
+                check_close<asymmetric_t>(output.source[0].i, if_ref, numerical_tolerance);
+            }
+
+            SUBCASE("Source on 2phg solid fault") {
+                // sequence components of the fault current, with phase a as reference
+                DoubleComplex const i_1 = vref / (zref + zref * zref_0 / (zref + zref_0));
+                DoubleComplex const i_2 = -i_1 * zref_0 / (zref + zref_0);
+                DoubleComplex const i_0 = -i_1 * zref / (zref + zref_0);
+                ComplexValue<asymmetric_t> const if_ref{0.0, i_0 + a * a * i_1 + a * i_2, i_0 + a * i_1 + a * a * i_2};
+
+                auto sc_input =
+                    create_sc_test_input(two_phase_to_ground, FaultPhase::bc, y_fault_solid, vref, fault_buses_2);
+                auto output = solver_z0.run_short_circuit(y_bus_z0, sc_input);
+                check_close<asymmetric_t>(output.fault[0].i_fault, if_ref, numerical_tolerance);
+                check_close<asymmetric_t>(output.source[0].i, if_ref, numerical_tolerance);
+            }
+        }
+    }
+}
+
+TEST_CASE("Short circuit solver - fault scan") {
+    // Test case grid
+    // source -- bus --- line -- bus
+    MathModelTopology topo_sc;
+    topo_sc.slack_bus = 0;
+    topo_sc.phase_shift = {0.0, 0.0};
+    topo_sc.branch_bus_idx = {{0, 1}};
+    topo_sc.sources_per_bus = {from_sparse, {0, 1, 1}};
+    topo_sc.shunts_per_bus = {from_sparse, {0, 0, 0}};
+    topo_sc.load_gens_per_bus = {from_sparse, {0, 0, 0}};
+    DenseGroupedIdxVector const fault_buses{from_sparse, {0, 0, 1}};
+
+    double const vref = 1.1;
+    DoubleComplex const yref{10.0 - 50.0i};
+    DoubleComplex const zref{1.0 / yref};
+    DoubleComplex const y0{1.0 - 2.0i};
+    DoubleComplex const y0_0{0.5 + 0.5i};
+    DoubleComplex const z0{1.0 / y0};
+    DoubleComplex const z0_0{1.0 / y0_0};
+    DoubleComplex const y_fault_solid{std::numeric_limits<double>::infinity(),
+                                      std::numeric_limits<double>::infinity()};
+
+    MathModelParam<symmetric_t> param_sc_sym;
+    param_sc_sym.branch_param = {{y0, -y0, -y0, y0}};
+    param_sc_sym.source_param = {SourceCalcParam{.y1 = yref, .y0 = yref}};
+
+    MathModelParam<asymmetric_t> param_sc_asym;
+    ComplexTensor<asymmetric_t> const y0a{(2.0 * y0 + y0_0) / 3.0, (y0_0 - y0) / 3.0};
+    param_sc_asym.branch_param = {{y0a, -y0a, -y0a, y0a}};
+    param_sc_asym.source_param = {SourceCalcParam{.y1 = yref, .y0 = yref}};
+
+    auto topo_sc_ptr = std::make_shared<MathModelTopology const>(topo_sc);
+    auto param_sym_ptr = std::make_shared<MathModelParam<symmetric_t> const>(param_sc_sym);
+    auto param_asym_ptr = std::make_shared<MathModelParam<asymmetric_t> const>(param_sc_asym);
+
+    SUBCASE("Symmetric") {
+        YBus<symmetric_t> const y_bus_sym{topo_sc_ptr, param_sym_ptr};
+        ShortCircuitSolver<symmetric_t> solver{y_bus_sym, topo_sc_ptr};
+
+        auto const output = solver.run_fault_scan(y_bus_sym, {vref});
+        REQUIRE(output.size() == 2);
+        check_close<symmetric_t>(output[0].u_pre_fault, vref);
+        check_close<symmetric_t>(output[1].u_pre_fault, vref);
+        CHECK(cabs(output[0].z_thevenin - zref) < numerical_tolerance);
+        CHECK(cabs(output[1].z_thevenin - (zref + z0)) < numerical_tolerance);
+        check_close<symmetric_t>(output[0].i_fault_three_phase, vref / zref);
+        check_close<symmetric_t>(output[1].i_fault_three_phase, vref / (zref + z0));
+        CHECK(is_nan(output[1].i_fault_single_phase));
+
+        // same as a bolted three phase fault calculation
+        auto const sc_input = create_sc_test_input(three_phase, FaultPhase::abc, y_fault_solid, vref, fault_buses);
+        auto const sc_output = solver.run_short_circuit(y_bus_sym, sc_input);
+        check_close<symmetric_t>(output[1].i_fault_three_phase, sc_output.fault[0].i_fault);
+
+        // selected buses
+        auto const output_selected = solver.run_fault_scan(y_bus_sym, {vref}, {1});
+        REQUIRE(output_selected.size() == 1);
+        check_close<symmetric_t>(output_selected[0].i_fault_three_phase, output[1].i_fault_three_phase);
+    }
+
+    SUBCASE("Asymmetric") {
+        YBus<asymmetric_t> const y_bus_asym{topo_sc_ptr, param_asym_ptr};
+        ShortCircuitSolver<asymmetric_t> solver{y_bus_asym, topo_sc_ptr};
+
+        auto const output = solver.run_fault_scan(y_bus_asym, {vref});
+        REQUIRE(output.size() == 2);
+        check_close<asymmetric_t>(output[1].u_pre_fault, ComplexValue<asymmetric_t>{vref});
+        CHECK((cabs(output[1].z_thevenin - (ComplexTensor<asymmetric_t>{zref} + inv(y0a))) < numerical_tolerance)
+                  .all());
+        check_close<asymmetric_t>(output[1].i_fault_three_phase, ComplexValue<asymmetric_t>{vref / (zref + z0)});
+        DoubleComplex const if_1phg = 3.0 * vref / (2.0 * (zref + z0) + (z0_0 + zref));
+        CHECK(cabs(output[1].i_fault_single_phase(0) - if_1phg) < numerical_tolerance);
+
+        // same as bolted fault calculations
+        for (auto const& [fault_type, fault_phase] :
+             {std::pair{three_phase, FaultPhase::abc}, std::pair{single_phase_to_ground, FaultPhase::a}}) {
+            auto const sc_input = create_sc_test_input(fault_type, fault_phase, y_fault_solid, vref, fault_buses);
+            auto const sc_output = solver.run_short_circuit(y_bus_asym, sc_input);
+            if (fault_type == three_phase) {
+                check_close<asymmetric_t>(output[1].i_fault_three_phase, sc_output.fault[0].i_fault);
+            } else {
+                CHECK(cabs(output[1].i_fault_single_phase(0) - sc_output.fault[0].i_fault(0)) < numerical_tolerance);
+            }
+        }
     }
 }
 
@@ -9,6 +9,7 @@
 #include "test_math_solver_common.hpp"
 
 #include <power_grid_model/common/calculation_info.hpp>
+#include <power_grid_model/common/timer.hpp>
 #include <power_grid_model/math_solver/sparse_lu_solver.hpp>
 #include <power_grid_model/math_solver/y_bus.hpp>
 
@@ -224,6 +225,50 @@ TEST_CASE_TEMPLATE_DEFINE("Test math solver - SE", SolverType, test_math_solver_
     }
 }
 
+TEST_CASE_TEMPLATE_DEFINE("Test math solver - SE, tracking", SolverType, test_math_solver_se_tracking_id) {
+    constexpr auto error_tolerance{1e-10};
+    constexpr auto num_iter{20};
+    auto const iteration_key = Timer::make_key(2228, "Max number of iterations");
+
+    using sym = typename SolverType::sym;
+
+    SESolverTestGrid<sym> const grid;
+
+    // topo and param ptr
+    auto param_ptr = std::make_shared<MathModelParam<sym> const>(grid.param());
+    auto topo_ptr = std::make_shared<MathModelTopology const>(grid.topo());
+    YBus<sym> const y_bus{topo_ptr, param_ptr};
+    SolverType solver{y_bus, topo_ptr};
+
+    auto const se_input = grid.se_input_angle();
+    auto const run = [&] {
+        CalculationInfo info;
+        auto const output = run_state_estimation(solver, y_bus, se_input, error_tolerance, num_iter, info);
+        assert_output(output, grid.output_ref());
+        return info[iteration_key];
+    };
+
+    auto const n_iter_flat_start = run();
+    CHECK(n_iter_flat_start > 1.0);
+
+    SUBCASE("Tracking disabled") { CHECK(run() == n_iter_flat_start); }
+
+    SUBCASE("Tracking enabled") {
+        solver.set_tracking(true);
+        // no previous estimate yet
+        CHECK(run() == n_iter_flat_start);
+        // start from the previous estimate, which is already converged
+        CHECK(run() < n_iter_flat_start);
+        CHECK(run() < n_iter_flat_start);
+
+        // disabling tracking discards the previous estimate
+        solver.set_tracking(false);
+        CHECK(run() == n_iter_flat_start);
+        solver.set_tracking(true);
+        CHECK(run() == n_iter_flat_start);
+    }
+}
+
 TEST_CASE_TEMPLATE_DEFINE("Test math solver - SE, zero variance test", SolverType,
                           test_math_solver_se_zero_variance_id) {
     /*
@@ -16,6 +16,72 @@ TYPE_TO_STRING_AS("IterativeLinearSESolver<asymmetric_t>",
 namespace power_grid_model::math_solver {
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, IterativeLinearSESolver<symmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_id, IterativeLinearSESolver<asymmetric_t>);
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_tracking_id, IterativeLinearSESolver<symmetric_t>);
+TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_tracking_id, IterativeLinearSESolver<asymmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_zero_variance_id, IterativeLinearSESolver<symmetric_t>);
 TEST_CASE_TEMPLATE_INVOKE(test_math_solver_se_measurements_id, IterativeLinearSESolver<symmetric_t>);
+
+TEST_CASE_TEMPLATE("Test math solver - SE, re-use pre-factorized gain matrix", sym, symmetric_t, asymmetric_t) {
+    constexpr auto error_tolerance{1e-10};
+    constexpr auto num_iter{20};
+    auto const prepare_matrix_key = Timer::make_key(2222, "Prepare matrix, including pre-factorization");
+
+    SESolverTestGrid<sym> const grid;
+    auto param_ptr = std::make_shared<MathModelParam<sym> const>(grid.param());
+    auto topo_ptr = std::make_shared<MathModelTopology const>(grid.topo());
+    YBus<sym> const y_bus{topo_ptr, param_ptr};
+    IterativeLinearSESolver<sym> solver{y_bus, topo_ptr};
+
+    auto const run = [&](StateEstimationInput<sym> const& se_input) {
+        CalculationInfo info;
+        auto const output = run_state_estimation(solver, y_bus, se_input, error_tolerance, num_iter, info);
+        return std::make_pair(output, info.contains(prepare_matrix_key));
+    };
+
+    auto const se_input = grid.se_input_angle();
+    auto se_input_other_variance = se_input;
+    se_input_other_variance.measured_branch_from_power.front().real_component.variance = RealValue<sym>{0.25};
+
+    // first calculation always prepares the matrix
+    auto [output, prepared] = run(se_input);
+    CHECK(prepared);
+    assert_output(output, grid.output_ref());
+
+    SUBCASE("Same sensors and variances") {
+        std::tie(output, prepared) = run(se_input);
+        CHECK_FALSE(prepared);
+        assert_output(output, grid.output_ref());
+    }
+
+    SUBCASE("Different variance") {
+        std::tie(output, prepared) = run(se_input_other_variance);
+        CHECK(prepared);
+        assert_output(output, grid.output_ref());
+
+        std::tie(output, prepared) = run(se_input_other_variance);
+        CHECK_FALSE(prepared);
+        assert_output(output, grid.output_ref());
+    }
+
+    SUBCASE("Different sensors") {
+        std::tie(output, prepared) = run(grid.se_input_angle_const_z());
+        CHECK(prepared);
+        assert_output(output, grid.output_ref_z());
+
+        std::tie(output, prepared) = run(se_input);
+        CHECK(prepared);
+        assert_output(output, grid.output_ref());
+    }
+
+    SUBCASE("Parameters changed") {
+        solver.parameters_changed(false);
+        std::tie(output, prepared) = run(se_input);
+        CHECK_FALSE(prepared);
+
+        solver.parameters_changed(true);
+        std::tie(output, prepared) = run(se_input);
+        CHECK(prepared);
+        assert_output(output, grid.output_ref());
+    }
+}
 } // namespace power_grid_model::math_solver
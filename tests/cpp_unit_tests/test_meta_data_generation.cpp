@@ -8,6 +8,8 @@
 
 #include <doctest/doctest.h>
 
+#include <type_traits>
+
 namespace power_grid_model {
 
 using namespace std::string_literals;
@@ -63,6 +65,38 @@ TEST_CASE("Test column row conversion") {
         CHECK(sensor_attr[1].name == "u_sigma"s);
         CHECK(sensor_attr[1].ctype == CType::c_double);
     }
+
+    SUBCASE("Test generated visitor of the attribute values") {
+        for (auto const& dataset : meta_data::meta_data_gen::meta_data.datasets) {
+            for (auto const& component : dataset.components) {
+                CAPTURE(dataset.name);
+                CAPTURE(component.name);
+                bool const visited = meta_data::meta_data_gen::visit_component_struct(
+                    component, [&component]<class StructType>() {
+                        CHECK(sizeof(StructType) == component.size);
+                        StructType const element{};
+                        size_t position{};
+                        meta_data::get_attributes_list<StructType>::visit_values(
+                            element, [&component, &element, &position](auto const& value) {
+                                REQUIRE(position < component.attributes.size());
+                                auto const& attribute = component.attributes[position];
+                                CHECK(static_cast<size_t>(reinterpret_cast<char const*>(&value) -
+                                                          reinterpret_cast<char const*>(&element)) ==
+                                      attribute.offset);
+                                CHECK(meta_data::ctype_v<std::remove_cvref_t<decltype(value)>> == attribute.ctype);
+                                ++position;
+                            });
+                        CHECK(position == component.attributes.size());
+                    });
+                CHECK(visited);
+            }
+        }
+
+        // a component which is not part of the generated meta data is not visited
+        meta_data::MetaComponent const custom_node =
+            meta_data::meta_data_gen::meta_data.get_dataset("input").get_component("node");
+        CHECK_FALSE(meta_data::meta_data_gen::visit_component_struct(custom_node, []<class StructType>() {}));
+    }
 }
 
 } // namespace power_grid_model
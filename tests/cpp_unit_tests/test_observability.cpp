@@ -173,4 +173,84 @@ TEST_CASE("Necessary observability check") {
         }
     }
 }
+
+TEST_CASE("Observability cache") {
+    /*
+            bus_2 --branch_1-- bus_1 --branch_0-- bus_0 -- source
+    */
+    MathModelTopology topo;
+    topo.slack_bus = 0;
+    topo.is_radial = true;
+    topo.phase_shift = {0.0, 0.0, 0.0};
+    topo.branch_bus_idx = {{0, 1}, {1, 2}};
+    topo.sources_per_bus = {from_sparse, {0, 1, 1, 1}};
+    topo.shunts_per_bus = {from_sparse, {0, 0, 0, 0}};
+    topo.load_gens_per_bus = {from_sparse, {0, 0, 0, 0}};
+    topo.power_sensors_per_bus = {from_sparse, {0, 0, 0, 0}};
+    topo.power_sensors_per_source = {from_sparse, {0, 0}};
+    topo.power_sensors_per_load_gen = {from_sparse, {0}};
+    topo.power_sensors_per_shunt = {from_sparse, {0}};
+    topo.power_sensors_per_branch_from = {from_sparse, {0, 1, 2}};
+    topo.power_sensors_per_branch_to = {from_sparse, {0, 0, 0}};
+    topo.current_sensors_per_branch_from = {from_sparse, {0, 0, 0}};
+    topo.current_sensors_per_branch_to = {from_sparse, {0, 0, 0}};
+    topo.voltage_sensors_per_bus = {from_sparse, {0, 1, 1, 1}};
+
+    MathModelParam<symmetric_t> param;
+    param.source_param = {SourceCalcParam{.y1 = 10.0 - 50.0i, .y0 = 10.0 - 50.0i}};
+    param.branch_param = {{1.0, -1.0, -1.0, 1.0}, {1.0, -1.0, -1.0, 1.0}};
+
+    auto topo_ptr = std::make_shared<MathModelTopology const>(topo);
+    auto param_ptr = std::make_shared<MathModelParam<symmetric_t> const>(param);
+    YBus<symmetric_t> const y_bus{topo_ptr, param_ptr};
+
+    StateEstimationInput<symmetric_t> se_input;
+    se_input.source_status = {1};
+    se_input.measured_voltage = {{.value = {1.0, nan}, .variance = 1.0}};
+    se_input.measured_branch_from_power = {
+        {.real_component = {.value = 1.0, .variance = 1.0}, .imag_component = {.value = 0.0, .variance = 1.0}},
+        {.real_component = {.value = 0.5, .variance = 1.0}, .imag_component = {.value = 0.0, .variance = 1.0}}};
+
+    math_solver::ObservabilityCache cache;
+    auto const check = [&cache, &y_bus](StateEstimationInput<symmetric_t> const& input) {
+        math_solver::MeasuredValues<symmetric_t> const measured_values{y_bus.shared_topology(), input};
+        auto const result = cache.check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure());
+        auto const reference = math_solver::necessary_observability_check(measured_values, y_bus.math_topology(),
+                                                                          y_bus.y_bus_structure());
+        CHECK(result.is_sufficiently_observable == reference.is_sufficiently_observable);
+        CHECK(result.is_possibly_ill_conditioned == reference.is_possibly_ill_conditioned);
+        return result;
+    };
+
+    CHECK(cache.size() == 0);
+    auto const result = check(se_input);
+    CHECK(result.is_sufficiently_observable);
+    CHECK(cache.size() == 1);
+
+    SUBCASE("Same sensors, different values") {
+        se_input.measured_voltage.front().value = {1.05, nan};
+        se_input.measured_branch_from_power.front().real_component.value = 2.0;
+        se_input.measured_branch_from_power.front().real_component.variance = 3.0;
+        check(se_input);
+        CHECK(cache.size() == 1);
+    }
+
+    SUBCASE("Voltage angle measurement") {
+        se_input.measured_voltage.front().value = 1.0;
+        check(se_input);
+        CHECK(cache.size() == 2);
+        check(se_input);
+        CHECK(cache.size() == 2);
+    }
+
+    SUBCASE("Unobservable pattern is not cached") {
+        // a voltage sensor with infinite variance is considered as not measured
+        se_input.measured_voltage.front().variance = std::numeric_limits<double>::infinity();
+        math_solver::MeasuredValues<symmetric_t> const measured_values{y_bus.shared_topology(), se_input};
+        CHECK_THROWS_AS(cache.check(measured_values, y_bus.math_topology(), y_bus.y_bus_structure()),
+                        NotObservableError);
+        CHECK(cache.size() == 1);
+    }
+}
+
 } // namespace power_grid_model
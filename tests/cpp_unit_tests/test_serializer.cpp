@@ -7,7 +7,13 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <limits>
+#include <span>
+#include <string>
 
 namespace power_grid_model::meta_data {
 
@@ -262,4 +268,76 @@ TEST_CASE("Serializer") {
     }
 }
 
+
+TEST_CASE("Serializer writes to a sink") {
+    // large enough to be written in multiple pieces
+    constexpr Idx n_loads = 10000;
+    std::vector<SymLoadGenUpdate> sym_load_gen(n_loads);
+    meta_data_gen::meta_data.get_dataset("update").get_component("sym_load").set_nan(sym_load_gen.data(), 0, n_loads);
+    for (Idx idx = 0; idx < n_loads; ++idx) {
+        auto& load = sym_load_gen[idx];
+        load.id = static_cast<ID>(idx);
+        load.status = static_cast<IntS>(idx % 2);
+        load.p_specified = 1.0e6 + 0.125 * static_cast<double>(idx);
+        load.q_specified = -0.5 * static_cast<double>(idx);
+    }
+    ConstDataset handler{true, 2, "update", meta_data_gen::meta_data};
+    handler.add_buffer("sym_load", n_loads / 2, n_loads, nullptr, sym_load_gen.data());
+
+    std::string written;
+    std::vector<size_t> piece_sizes;
+    auto sink = [&written, &piece_sizes](std::span<char const> data) {
+        written.append(data.data(), data.size());
+        piece_sizes.push_back(data.size());
+    };
+    constexpr auto capacity = detail::StagingBuffer::capacity;
+
+    SUBCASE("json") {
+        Serializer serializer{handler, SerializationFormat::json};
+        for (Idx const indent : {-1, 0, 2}) {
+            for (bool const use_compact_list : {true, false}) {
+                written.clear();
+                piece_sizes.clear();
+                serializer.write(sink, use_compact_list, indent);
+                CHECK(written == serializer.get_string(use_compact_list, indent));
+                CHECK(piece_sizes.size() > 1);
+                CHECK(std::ranges::all_of(piece_sizes, [](size_t size) { return size > 0 && size <= capacity; }));
+            }
+        }
+    }
+
+    SUBCASE("msgpack") {
+        Serializer serializer{handler, SerializationFormat::msgpack};
+        for (bool const use_compact_list : {true, false}) {
+            written.clear();
+            piece_sizes.clear();
+            serializer.write(sink, use_compact_list, -1);
+            auto const buffer = serializer.get_binary_buffer(use_compact_list);
+            CHECK(written == std::string_view{buffer.data(), buffer.size()});
+            CHECK(piece_sizes.size() > 1);
+            CHECK(std::ranges::all_of(piece_sizes, [](size_t size) { return size > 0 && size <= capacity; }));
+        }
+    }
+
+    SUBCASE("Exception in sink") {
+        Serializer serializer{handler, SerializationFormat::json};
+        auto throwing_sink = [](std::span<char const> /* data */) { throw SerializationError{"sink full"}; };
+        CHECK_THROWS_AS(serializer.write(throwing_sink, true, -1), SerializationError);
+    }
+
+    SUBCASE("File") {
+        auto const file_path = std::filesystem::temp_directory_path() / "pgm_test_serializer_write_to_file.json";
+        Serializer serializer{handler, SerializationFormat::json};
+        serializer.write_to_file(file_path, true, 2);
+        std::ifstream file{file_path, std::ios::binary};
+        std::string const file_content{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+        file.close();
+        std::filesystem::remove(file_path);
+        CHECK(file_content == serializer.get_string(true, 2));
+
+        CHECK_THROWS_AS(serializer.write_to_file(file_path / "no_such_directory" / "file.json", true, 2),
+                        SerializationError);
+    }
+}
+
 } // namespace power_grid_model::meta_data
\ No newline at end of file
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/common/three_phase_tensor.hpp>
+#include <power_grid_model/math_solver/sparse_ldl_solver.hpp>
+#include <power_grid_model/math_solver/sparse_lu_solver.hpp>
+
+#include <doctest/doctest.h>
+
+namespace power_grid_model::math_solver {
+namespace {
+template <class T> void check_result(std::vector<T> const& x, std::vector<T> const& x_solver) {
+    CHECK(x.size() == x_solver.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        if constexpr (scalar_value<T>) {
+            CHECK(cabs(x[i] - x_solver[i]) < numerical_tolerance);
+        } else {
+            CHECK((cabs(x[i] - x_solver[i]) < numerical_tolerance).all());
+        }
+    }
+}
+
+// test block calculation with 2*2
+using Tensor = Eigen::Array<double, 2, 2, Eigen::ColMajor>;
+using Array = Eigen::Array<double, 2, 1, Eigen::ColMajor>;
+
+// 3 * 3 matrix, with diagonal, two fill-ins
+/// x x x
+/// x x f
+/// x f x
+auto const row_indptr = std::make_shared<IdxVector const>(IdxVector{0, 3, 6, 9});
+auto const col_indices = std::make_shared<IdxVector const>(IdxVector{0, 1, 2, 0, 1, 2, 0, 1, 2});
+auto const diag_lu = std::make_shared<IdxVector const>(IdxVector{0, 4, 8});
+// same matrix, only the upper triangle
+auto const row_indptr_upper = std::make_shared<IdxVector const>(IdxVector{0, 3, 5, 6});
+auto const col_indices_upper = std::make_shared<IdxVector const>(IdxVector{0, 1, 2, 1, 2, 2});
+auto const diag_upper = std::make_shared<IdxVector const>(IdxVector{0, 3, 5});
+
+template <class T> std::vector<T> upper_triangle(std::vector<T> const& full_data) {
+    return {full_data[0], full_data[1], full_data[2], full_data[4], full_data[5], full_data[8]};
+}
+} // namespace
+
+TEST_CASE("Test Sparse LDL solver") {
+    SUBCASE("Scalar(double) calculation") {
+        // [4 1 2        3          15
+        //  1 7 f     * [-1]   =  [-4 ]
+        //  2 f 6]       2          18
+        std::vector<double> const full_data = {
+            4, 1, 2, // row 0
+            1, 7, 0, // row 1
+            2, 0, 6  // row 2
+        };
+        std::vector<double> const rhs = {15, -4, 18};
+        std::vector<double> const x_ref = {3, -1, 2};
+        std::vector<double> x(3, 0.0);
+        SparseLDLSolver<double, double, double>::BlockPermArray block_perm{};
+
+        SUBCASE("Full structure") {
+            auto data = full_data;
+            SparseLDLSolver<double, double, double> solver{row_indptr, col_indices, diag_lu};
+            solver.prefactorize_and_solve(data, block_perm, rhs, x);
+            check_result(x, x_ref);
+            // lower triangle is untouched
+            CHECK(data[3] == 1.0);
+            CHECK(data[6] == 2.0);
+            CHECK(data[7] == 0.0);
+        }
+
+        SUBCASE("Upper triangle structure") {
+            auto data = upper_triangle(full_data);
+            SparseLDLSolver<double, double, double> solver{row_indptr_upper, col_indices_upper, diag_upper};
+
+            SUBCASE("Test calculation") {
+                solver.prefactorize_and_solve(data, block_perm, rhs, x);
+                check_result(x, x_ref);
+            }
+
+            SUBCASE("Test prefactorize and solve in-place") {
+                solver.prefactorize(data, block_perm);
+                x = rhs;
+                solver.solve_with_prefactorized_matrix((std::vector<double> const&)data, block_perm, x, x);
+                check_result(x, x_ref);
+            }
+
+            SUBCASE("Test (pseudo) singular") {
+                data[0] = 0.0;
+                CHECK_THROWS_AS(solver.prefactorize_and_solve(data, block_perm, rhs, x), SparseMatrixError);
+            }
+        }
+    }
+
+    SUBCASE("Scalar(complex) hermitian calculation") {
+        // [4      1+1j  2j        1+1j        -1+3j
+        //  1-1j   7     f     * [ -1   ]  = [ -5    ]
+        //  -2j    f     6]        2j          2+10j
+        std::vector<DoubleComplex> data = {4.0, {1.0, 1.0}, {0.0, 2.0}, 7.0, 0.0, 6.0};
+        std::vector<DoubleComplex> const rhs = {{-1.0, 3.0}, -5.0, {2.0, 10.0}};
+        std::vector<DoubleComplex> const x_ref = {{1.0, 1.0}, -1.0, {0.0, 2.0}};
+        std::vector<DoubleComplex> x(3, 0.0);
+        SparseLDLSolver<DoubleComplex, DoubleComplex, DoubleComplex> solver{row_indptr_upper, col_indices_upper,
+                                                                           diag_upper};
+        SparseLDLSolver<DoubleComplex, DoubleComplex, DoubleComplex>::BlockPermArray block_perm{};
+
+        solver.prefactorize_and_solve(data, block_perm, rhs, x);
+        check_result(x, x_ref);
+    }
+
+    SUBCASE("Block(double 2*2) indefinite calculation") {
+        // symmetric indefinite matrix, the first diagonal block needs pivoting inside the block
+        // [ 0 1   1  2   0  1           1
+        //   1 0   3  4   2  0           2
+        //   1 3   5  0   f  f       * [-1 ]
+        //   2 4   0 -3   f  f           3
+        //   0 2   f  f  -2  1           2
+        //   1 0   f  f   1  4 ]        -2
+        std::vector<Tensor> const full_data = {
+            {{0, 1}, {1, 0}},  // 0, 0
+            {{1, 2}, {3, 4}},  // 0, 1
+            {{0, 1}, {2, 0}},  // 0, 2
+            {{1, 3}, {2, 4}},  // 1, 0
+            {{5, 0}, {0, -3}}, // 1, 1
+            {{0, 0}, {0, 0}},  // 1, 2
+            {{0, 2}, {1, 0}},  // 2, 0
+            {{0, 0}, {0, 0}},  // 2, 1
+            {{-2, 1}, {1, 4}}, // 2, 2
+        };
+        std::vector<Array> const x_ref = {{1, 2}, {-1, 3}, {2, -2}};
+        std::vector<Array> rhs(3, Array::Zero());
+        for (Idx row = 0; row != 3; ++row) {
+            for (Idx idx = (*row_indptr)[row]; idx != (*row_indptr)[row + 1]; ++idx) {
+                rhs[row] += dot(full_data[idx], x_ref[(*col_indices)[idx]]);
+            }
+        }
+        std::vector<Array> x(3, Array::Zero());
+        SparseLDLSolver<Tensor, Array, Array>::BlockPermArray block_perm(3);
+
+        SUBCASE("Test calculation") {
+            auto data = upper_triangle(full_data);
+            SparseLDLSolver<Tensor, Array, Array> solver{row_indptr_upper, col_indices_upper, diag_upper};
+            solver.prefactorize_and_solve(data, block_perm, rhs, x);
+            check_result(x, x_ref);
+        }
+
+        SUBCASE("Same result as LU solver") {
+            auto data_ldl = full_data;
+            auto data_lu = full_data;
+            std::vector<Array> x_lu(3, Array::Zero());
+            SparseLDLSolver<Tensor, Array, Array> ldl_solver{row_indptr, col_indices, diag_lu};
+            SparseLUSolver<Tensor, Array, Array> lu_solver{row_indptr, col_indices, diag_lu};
+            SparseLUSolver<Tensor, Array, Array>::BlockPermArray block_perm_lu(3);
+            ldl_solver.prefactorize_and_solve(data_ldl, block_perm, rhs, x);
+            lu_solver.prefactorize_and_solve(data_lu, block_perm_lu, rhs, x_lu);
+            check_result(x, x_lu);
+            // the pivots are the same
+            for (Idx row = 0; row != 3; ++row) {
+                Idx const diag = (*diag_lu)[row];
+                CHECK((cabs(data_ldl[diag] - data_lu[diag]) < numerical_tolerance).all());
+            }
+        }
+
+        SUBCASE("Test (pseudo) singular") {
+            auto data = upper_triangle(full_data);
+            data[0] = Tensor::Zero();
+            SparseLDLSolver<Tensor, Array, Array> solver{row_indptr_upper, col_indices_upper, diag_upper};
+            CHECK_THROWS_AS(solver.prefactorize_and_solve(data, block_perm, rhs, x), SparseMatrixError);
+        }
+    }
+}
+
+} // namespace power_grid_model::math_solver
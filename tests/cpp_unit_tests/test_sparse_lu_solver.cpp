@@ -197,4 +197,86 @@ TEST_CASE("LU solver with ill-conditioned system") {
     }
 }
 
+TEST_CASE("Test selected inversion with LU solver") {
+    // 4 * 4 matrix, with diagonal, one fill-in, (0, 3) and (1, 3) are not in the structure
+    /// x x x
+    /// x x f
+    /// x f x x
+    ///     x x
+    auto const row_indptr = std::make_shared<IdxVector const>(IdxVector{0, 3, 6, 10, 12});
+    auto const col_indices = std::make_shared<IdxVector const>(IdxVector{0, 1, 2, 0, 1, 2, 0, 1, 2, 3, 2, 3});
+    auto const diag_lu = std::make_shared<IdxVector const>(IdxVector{0, 4, 8, 11});
+
+    // compare the inverse with the dense inverse at all the positions in the structure
+    auto const check_inverse = [&row_indptr, &col_indices]<class T>(std::vector<T> const& data,
+                                                                     std::vector<T> const& inverse, Idx block_size) {
+        Eigen::MatrixXd dense = Eigen::MatrixXd::Zero(4 * block_size, 4 * block_size);
+        for (Idx row = 0; row != 4; ++row) {
+            for (Idx idx = (*row_indptr)[row]; idx != (*row_indptr)[row + 1]; ++idx) {
+                Idx const col = (*col_indices)[idx];
+                if constexpr (scalar_value<T>) {
+                    dense(row, col) = data[idx];
+                } else {
+                    dense.block(row * block_size, col * block_size, block_size, block_size) = data[idx].matrix();
+                }
+            }
+        }
+        Eigen::MatrixXd const dense_inverse = dense.inverse();
+        REQUIRE(inverse.size() == data.size());
+        for (Idx row = 0; row != 4; ++row) {
+            for (Idx idx = (*row_indptr)[row]; idx != (*row_indptr)[row + 1]; ++idx) {
+                Idx const col = (*col_indices)[idx];
+                if constexpr (scalar_value<T>) {
+                    CHECK(inverse[idx] == doctest::Approx(dense_inverse(row, col)));
+                } else {
+                    Eigen::MatrixXd const block =
+                        dense_inverse.block(row * block_size, col * block_size, block_size, block_size);
+                    CHECK((cabs(inverse[idx] - block.array()) < numerical_tolerance).all());
+                }
+            }
+        }
+    };
+
+    SUBCASE("Scalar(double) calculation") {
+        std::vector<double> const data = {
+            4, 1, 5,    // row 0
+            3, 7, 0,    // row 1
+            2, 0, 6, 1, // row 2
+            -2, 3       // row 3
+        };
+        std::vector<double> lu_data = data;
+        std::vector<double> inverse;
+        SparseLUSolver<double, double, double> solver{row_indptr, col_indices, diag_lu};
+        SparseLUSolver<double, double, double>::BlockPermArray block_perm{};
+        solver.prefactorize(lu_data, block_perm);
+        solver.invert_selected(lu_data, block_perm, inverse);
+        check_inverse(data, inverse, 1);
+    }
+
+    SUBCASE("Block(double 2*2) calculation") {
+        // the first pivot needs permutation
+        std::vector<Tensor> const data = {
+            {{0, 1}, {100, 0}},  // 0, 0
+            {{1, 2}, {7, -1}},   // 0, 1
+            {{3, 4}, {5, 6}},    // 0, 2
+            {{1, 2}, {-3, 4}},   // 1, 0
+            {{0, 200}, {3, 1}},  // 1, 1
+            {{0, 0}, {0, 0}},    // 1, 2
+            {{5, 6}, {-7, 8}},   // 2, 0
+            {{0, 0}, {0, 0}},    // 2, 1
+            {{1, 0}, {0, 100}},  // 2, 2
+            {{2, -1}, {0, 3}},   // 2, 3
+            {{1, 1}, {-2, 0}},   // 3, 2
+            {{10, 1}, {2, -20}}, // 3, 3
+        };
+        std::vector<Tensor> lu_data = data;
+        std::vector<Tensor> inverse;
+        SparseLUSolver<Tensor, Array, Array> solver{row_indptr, col_indices, diag_lu};
+        SparseLUSolver<Tensor, Array, Array>::BlockPermArray block_perm(4);
+        solver.prefactorize(lu_data, block_perm);
+        solver.invert_selected(lu_data, block_perm, inverse);
+        check_inverse(data, inverse, 2);
+    }
+}
+
 } // namespace power_grid_model::math_solver
@@ -1550,6 +1550,275 @@ TEST_CASE("Test Tap position optimizer") {
                 CHECK(twoStatesEqual(cached_state, state));
             }
         }
+
+        SUBCASE("Sensitivity search") {
+            state_b.rank = 0;
+            state_b.u_pu = [&state_b, &regulator_b](ControlSide /*side*/) {
+                return state_b.tap_side == regulator_b.control_side()
+                           ? static_cast<DoubleComplex>(
+                                 test::normalized_lerp(state_b.tap_pos, state_b.tap_min, state_b.tap_max))
+                           : static_cast<DoubleComplex>(
+                                 test::normalized_lerp(state_b.tap_pos, state_b.tap_max, state_b.tap_min));
+            };
+            state_b.tap_min = 0;
+            state_b.tap_max = 100;
+            state_b.tap_pos = 100;
+            regulator_b.update(TransformerTapRegulatorUpdate{.id = 4, .u_set = 0.305, .u_band = 0.02});
+
+            for (auto strategy : {OptimizerStrategy::any, OptimizerStrategy::fast_any}) {
+                for (auto tap_side : optimizer::test::tap_sides) {
+                    CAPTURE(strategy);
+                    CAPTURE(tap_side);
+
+                    state_b.tap_side = tap_side;
+                    state_a.tap_side = tap_side;
+
+                    auto optimizer = get_optimizer(strategy, SearchMethod::sensitivity_search);
+                    auto const result = optimizer.optimize(state, CalculationMethod::default_method);
+                    REQUIRE(result.solver_output.size() == 1);
+                    auto const tap_pos = result.solver_output.front().state_tap_positions.at(state_b.id);
+                    auto const voltage = tap_side == regulator_b.control_side()
+                                             ? test::normalized_lerp(tap_pos, state_b.tap_min, state_b.tap_max)
+                                             : test::normalized_lerp(tap_pos, state_b.tap_max, state_b.tap_min);
+                    CHECK(voltage >= 0.295);
+                    CHECK(voltage <= 0.315);
+                    // one probing step, one jump and the verification, instead of a step per tap position
+                    CHECK(optimizer.get_total_iterations() <= 3);
+                    CHECK(transformer_b.tap_pos() == 100);
+                }
+            }
+
+            for (auto strategy : {OptimizerStrategy::local_maximum, OptimizerStrategy::local_minimum,
+                                  OptimizerStrategy::global_maximum, OptimizerStrategy::global_minimum}) {
+                CAPTURE(strategy);
+                CHECK_THROWS_AS(get_optimizer(strategy, SearchMethod::sensitivity_search),
+                                TapSearchStrategyIncompatibleError);
+            }
+        }
+
+        SUBCASE("Ranking cache") {
+            state_a.rank = 0;
+            state_b.rank = 1;
+
+            pgm_tap::TransformerRankingCache ranking_cache;
+            auto const get_cached_optimizer = [&] {
+                return pgm_tap::TapPositionOptimizer<MockStateCalculator, std::remove_const_t<decltype(updater)>,
+                                                     MockState, MockTransformerRanker>{test::mock_state_calculator,
+                                                                                       updater,
+                                                                                       OptimizerStrategy::any,
+                                                                                       meta_data,
+                                                                                       SearchMethod::linear_search,
+                                                                                       {},
+                                                                                       {},
+                                                                                       &ranking_cache};
+            };
+            auto const check_ranking = [&](pgm_tap::RankedTransformerGroups const& expected) {
+                REQUIRE(ranking_cache != nullptr);
+                CHECK(ranking_cache->order == expected);
+                CHECK(ranking_cache->max_tap_ranges_per_rank.size() == expected.size());
+                CHECK(ranking_cache->regulator_status == std::vector<IntS>{regulator_a.status(), regulator_b.status()});
+            };
+
+            std::ignore = get_cached_optimizer().optimize(state, CalculationMethod::default_method);
+            check_ranking({{{.group = 0, .pos = 0}}, {{.group = 0, .pos = 1}}});
+            auto const* const cached = ranking_cache.get();
+
+            // the ranking is reused, even though the mock ranker would rank differently now
+            state_a.rank = 1;
+            state_b.rank = 0;
+            std::ignore = get_cached_optimizer().optimize(state, CalculationMethod::default_method);
+            CHECK(ranking_cache.get() == cached);
+            check_ranking({{{.group = 0, .pos = 0}}, {{.group = 0, .pos = 1}}});
+
+            SUBCASE("regulator status changed") {
+                regulator_a.update(TransformerTapRegulatorUpdate{.id = 3, .status = 0});
+                state_a.rank = MockTransformerState::unregulated;
+                std::ignore = get_cached_optimizer().optimize(state, CalculationMethod::default_method);
+                CHECK(ranking_cache.get() != cached);
+                check_ranking({{{.group = 0, .pos = 1}}});
+            }
+            SUBCASE("cache invalidated") {
+                ranking_cache.reset();
+                std::ignore = get_cached_optimizer().optimize(state, CalculationMethod::default_method);
+                check_ranking({{{.group = 0, .pos = 1}}, {{.group = 0, .pos = 0}}});
+            }
+        }
+
+        SUBCASE("Warm start") {
+            state_a.rank = MockTransformerState::unregulated;
+            state_b.rank = 0;
+            state_b.u_pu = [&state_b, &regulator_b](ControlSide /*side*/) {
+                return state_b.tap_side == regulator_b.control_side()
+                           ? static_cast<DoubleComplex>(
+                                 test::normalized_lerp(state_b.tap_pos, state_b.tap_min, state_b.tap_max))
+                           : static_cast<DoubleComplex>(
+                                 test::normalized_lerp(state_b.tap_pos, state_b.tap_max, state_b.tap_min));
+            };
+            state_b.tap_min = 0;
+            state_b.tap_max = 100;
+            state_b.tap_pos = 100;
+            regulator_b.update(TransformerTapRegulatorUpdate{.id = 4, .u_set = 0.305, .u_band = 0.02});
+
+            auto const get_warm_optimizer = [&](OptimizerStrategy strategy, SearchMethod tap_search,
+                                                IntS initial_tap_pos) {
+                return pgm_tap::TapPositionOptimizer<MockStateCalculator, std::remove_const_t<decltype(updater)>,
+                                                     MockState, MockTransformerRanker>{
+                    test::mock_state_calculator,
+                    updater,
+                    strategy,
+                    meta_data,
+                    tap_search,
+                    {},
+                    TransformerTapPositionOutput{{.transformer_id = state_b.id, .tap_position = initial_tap_pos}}};
+            };
+
+            constexpr std::array strategy_searches{
+                std::pair{OptimizerStrategy::any, SearchMethod::linear_search},
+                std::pair{OptimizerStrategy::fast_any, SearchMethod::binary_search}};
+            for (auto const& [strategy, search] : strategy_searches) {
+                for (auto tap_side : optimizer::test::tap_sides) {
+                    state_b.tap_side = tap_side;
+                    state_a.tap_side = tap_side;
+
+                    auto const voltage = [&tap_side, &regulator_b, &state_b](IntS tap_pos) {
+                        return tap_side == regulator_b.control_side()
+                                   ? test::normalized_lerp(tap_pos, state_b.tap_min, state_b.tap_max)
+                                   : test::normalized_lerp(tap_pos, state_b.tap_max, state_b.tap_min);
+                    };
+                    auto const u_set_tap_pos = static_cast<IntS>(tap_side == regulator_b.control_side() ? 31 : 69);
+
+                    for (IntS const initial_tap_pos :
+                         {u_set_tap_pos, static_cast<IntS>(u_set_tap_pos + 1), static_cast<IntS>(u_set_tap_pos + 2),
+                          IntS{90}, IntS{0}, IntS{120}}) {
+                        CAPTURE(strategy);
+                        CAPTURE(tap_side);
+                        CAPTURE(initial_tap_pos);
+
+                        auto optimizer = get_warm_optimizer(strategy, search, initial_tap_pos);
+                        auto const result = optimizer.optimize(state, CalculationMethod::default_method);
+
+                        REQUIRE(result.solver_output.size() == 1);
+                        auto const tap_pos = result.solver_output.front().state_tap_positions.at(state_b.id);
+                        CHECK(voltage(tap_pos) >= 0.295);
+                        CHECK(voltage(tap_pos) <= 0.315);
+                        if (initial_tap_pos == u_set_tap_pos) {
+                            // no search needed if the initial tap position is already in the band
+                            CHECK(tap_pos == u_set_tap_pos);
+                            CHECK(optimizer.get_total_iterations() == 1);
+                        }
+                        if (initial_tap_pos == u_set_tap_pos + 1) {
+                            // the tap position in the band is close to the initial one
+                            CHECK(optimizer.get_total_iterations() <= 2);
+                        }
+                        CHECK(transformer_b.tap_pos() == 100);
+                    }
+                }
+            }
+
+            // the other strategies always start from the extreme tap positions
+            for (auto strategy : {OptimizerStrategy::local_maximum, OptimizerStrategy::local_minimum,
+                                  OptimizerStrategy::global_maximum, OptimizerStrategy::global_minimum}) {
+                CAPTURE(strategy);
+                auto reference_optimizer = get_optimizer(strategy, SearchMethod::binary_search);
+                auto const reference = reference_optimizer.optimize(state, CalculationMethod::default_method);
+                auto optimizer = get_warm_optimizer(strategy, SearchMethod::binary_search, IntS{50});
+                auto const result = optimizer.optimize(state, CalculationMethod::default_method);
+
+                CHECK(result.solver_output.front().state_tap_positions.at(state_b.id) ==
+                      reference.solver_output.front().state_tap_positions.at(state_b.id));
+                CHECK(optimizer.get_total_iterations() == reference_optimizer.get_total_iterations());
+            }
+        }
+
+        SUBCASE("Speculative binary search") {
+            using CandidateEvaluator = pgm_tap::TapPositionOptimizer<MockStateCalculator,
+                                                                     std::remove_const_t<decltype(updater)>, MockState,
+                                                                     MockTransformerRanker>::CandidateEvaluator;
+            using ResultType = std::vector<test::MockSolverOutput<MockContainer>>;
+
+            state_a.rank = MockTransformerState::unregulated;
+            state_b.rank = 0;
+            state_b.u_pu = [&state_b, &regulator_b](ControlSide /*side*/) {
+                return state_b.tap_side == regulator_b.control_side()
+                           ? static_cast<DoubleComplex>(
+                                 test::normalized_lerp(state_b.tap_pos, state_b.tap_min, state_b.tap_max))
+                           : static_cast<DoubleComplex>(
+                                 test::normalized_lerp(state_b.tap_pos, state_b.tap_max, state_b.tap_min));
+            };
+            state_b.tap_min = 0;
+            state_b.tap_max = 100;
+            state_b.tap_pos = 100;
+            regulator_b.update(TransformerTapRegulatorUpdate{.id = 4, .u_set = 0.305, .u_band = 0.02});
+
+            // evaluate the candidates one by one on the state itself and restore it afterwards
+            Idx n_evaluator_calls{};
+            Idx n_candidates{};
+            bool fail_candidates{false};
+            CandidateEvaluator const evaluate_candidates = [&](std::vector<ConstDataset> const& candidates,
+                                                               CalculationMethod method) {
+                ++n_evaluator_calls;
+                n_candidates += static_cast<Idx>(candidates.size());
+
+                std::vector<std::optional<ResultType>> results;
+                for (auto const& candidate : candidates) {
+                    auto const tap_pos = state_b.tap_pos;
+                    updater(candidate);
+                    if (fail_candidates) {
+                        results.emplace_back(std::nullopt);
+                    } else {
+                        results.emplace_back(test::mock_state_calculator(state, method));
+                    }
+                    state_b.tap_pos = tap_pos;
+                }
+                return results;
+            };
+
+            for (auto strategy : {OptimizerStrategy::fast_any, OptimizerStrategy::local_maximum,
+                                  OptimizerStrategy::local_minimum, OptimizerStrategy::global_maximum,
+                                  OptimizerStrategy::global_minimum}) {
+                for (auto tap_side : optimizer::test::tap_sides) {
+                    for (bool const fail : {false, true}) {
+                        CAPTURE(strategy);
+                        CAPTURE(tap_side);
+                        CAPTURE(fail);
+
+                        state_b.tap_side = tap_side;
+                        state_a.tap_side = tap_side;
+                        fail_candidates = fail;
+                        n_evaluator_calls = 0;
+                        n_candidates = 0;
+
+                        auto reference_optimizer = get_optimizer(strategy, SearchMethod::binary_search);
+                        auto const reference = reference_optimizer.optimize(state, CalculationMethod::default_method);
+
+                        auto optimizer = pgm_tap::TapPositionOptimizer<MockStateCalculator,
+                                                                       std::remove_const_t<decltype(updater)>,
+                                                                       MockState, MockTransformerRanker>{
+                            test::mock_state_calculator,
+                            updater,
+                            strategy,
+                            meta_data,
+                            SearchMethod::binary_search,
+                            evaluate_candidates};
+                        auto const result = optimizer.optimize(state, CalculationMethod::default_method);
+
+                        REQUIRE(result.solver_output.size() == 1);
+                        CHECK(result.optimizer_output.transformer_tap_positions.size() == 1);
+                        CHECK(result.solver_output.front().state_tap_positions.at(state_b.id) ==
+                              reference.solver_output.front().state_tap_positions.at(state_b.id));
+                        CHECK(optimizer.get_total_iterations() == reference_optimizer.get_total_iterations());
+                        // both binary search halves are evaluated together with the current tap position
+                        CHECK(n_evaluator_calls > 0);
+                        CHECK(n_candidates > n_evaluator_calls);
+                        if (!fail) {
+                            // the speculatively evaluated tap positions are reused
+                            CHECK(n_evaluator_calls < optimizer.get_total_iterations() - 1);
+                        }
+                        CHECK(transformer_b.tap_pos() == 100);
+                    }
+                }
+            }
+        }
     }
 }
 
@@ -4,6 +4,7 @@
 
 #include <power_grid_model/component/three_winding_transformer.hpp>
 #include <power_grid_model/component/transformer.hpp>
+#include <power_grid_model/main_core/tap_param_table.hpp>
 
 #include <doctest/doctest.h>
 
@@ -600,6 +601,40 @@ TEST_CASE("Test three winding transformer") {
         CHECK(trafo_vec[1].tap_pos() == 0);
         CHECK(trafo_vec[1].tap_nom() == 0);
     }
+
+    SUBCASE("Tap parameter table") {
+        for (auto& transformer : vec) {
+            main_core::TapParamTable<ThreeWindingTransformer, symmetric_t> const sym_table{transformer};
+            main_core::TapParamTable<ThreeWindingTransformer, asymmetric_t> const asym_table{transformer};
+
+            for (IntS tap_pos = std::min(transformer.tap_min(), transformer.tap_max());
+                 tap_pos <= std::max(transformer.tap_min(), transformer.tap_max()); ++tap_pos) {
+                CAPTURE(tap_pos);
+                transformer.update(ThreeWindingTransformerUpdate{.id = 1, .tap_pos = tap_pos});
+
+                auto const* sym_param = sym_table.find(transformer);
+                auto const* asym_param = asym_table.find(transformer);
+                REQUIRE(sym_param != nullptr);
+                REQUIRE(asym_param != nullptr);
+                auto const expected_sym = transformer.calc_param<symmetric_t>();
+                auto const expected_asym = transformer.calc_param<asymmetric_t>();
+                for (size_t branch = 0; branch < 3; branch++) {
+                    for (size_t j = 0; j < 4; j++) {
+                        CHECK(cabs((*sym_param)[branch].value[j] - expected_sym[branch].value[j]) <
+                              numerical_tolerance);
+                        CHECK((cabs((*asym_param)[branch].value[j] - expected_asym[branch].value[j]) <
+                               numerical_tolerance)
+                                  .all());
+                    }
+                }
+            }
+
+            // the table is only valid for the status it was built with
+            transformer.update(ThreeWindingTransformerUpdate{.id = 1, .status_3 = 0});
+            CHECK(sym_table.find(transformer) == nullptr);
+            CHECK(asym_table.find(transformer) == nullptr);
+        }
+    }
 }
 
 } // namespace power_grid_model
@@ -321,6 +321,38 @@ TEST_CASE("Test topology") {
             CHECK(math.fill_in == math_ref.fill_in);
         }
     }
+
+    SUBCASE("Test unaffected math models") {
+        auto const [old_math_topology, old_topo_comp_coup] = Topology{comp_topo, comp_conn}.build_topology();
+
+        SUBCASE("Unchanged connections") {
+            auto const [math_topology, topo_comp_coup] = Topology{comp_topo, comp_conn}.build_topology();
+            CHECK(find_unaffected_math_models(old_math_topology, *old_topo_comp_coup, math_topology,
+                                              *topo_comp_coup) == IdxVector{0, 1});
+        }
+        SUBCASE("Branch within math model 1 opened") {
+            comp_conn.branch_connected[7] = {0, 1};
+            auto const [math_topology, topo_comp_coup] = Topology{comp_topo, comp_conn}.build_topology();
+            CHECK(find_unaffected_math_models(old_math_topology, *old_topo_comp_coup, math_topology,
+                                              *topo_comp_coup) == IdxVector{0, -1});
+        }
+        SUBCASE("Disconnected source connected") {
+            // island of node 9 becomes an extra math model, the other math models are unaffected
+            comp_conn.source_connected[2] = 1;
+            auto const [math_topology, topo_comp_coup] = Topology{comp_topo, comp_conn}.build_topology();
+            REQUIRE(math_topology.size() == 3);
+            CHECK(find_unaffected_math_models(old_math_topology, *old_topo_comp_coup, math_topology,
+                                              *topo_comp_coup) == IdxVector{0, 1, -1});
+        }
+        SUBCASE("Math models merged") {
+            // connects math model 0 and 1
+            comp_conn.branch_connected[5] = {1, 1};
+            auto const [math_topology, topo_comp_coup] = Topology{comp_topo, comp_conn}.build_topology();
+            REQUIRE(math_topology.size() == 1);
+            CHECK(find_unaffected_math_models(old_math_topology, *old_topo_comp_coup, math_topology,
+                                              *topo_comp_coup) == IdxVector{-1});
+        }
+    }
 }
 
 TEST_CASE("Test cycle reorder") {
@@ -363,6 +395,66 @@ TEST_CASE("Test cycle reorder") {
         auto const& math_topo = *pair.first[0];
         CHECK(topo_comp_coup.node == comp_coup_ref.node);
         CHECK(math_topo.fill_in == fill_in_ref);
+
+        SUBCASE("Reuse ordering of previous topology") {
+            SUBCASE("Unchanged") {
+                auto const [cached_math_topology, cached_topo_comp_coup] =
+                    Topology{comp_topo, comp_conn, pair.first, topo_comp_coup}.build_topology();
+                CHECK(cached_topo_comp_coup->node == comp_coup_ref.node);
+                CHECK(*cached_math_topology[0] == math_topo);
+            }
+            SUBCASE("Branch opened") {
+                // the opened branch 6 -> 8 is kept as fill-in
+                comp_conn.branch_connected[13] = {1, 0};
+                auto const [cached_math_topology, cached_topo_comp_coup] =
+                    Topology{comp_topo, comp_conn, pair.first, topo_comp_coup}.build_topology();
+                CHECK(cached_topo_comp_coup->node == comp_coup_ref.node);
+                CHECK(cached_math_topology[0]->fill_in ==
+                      std::vector<BranchIdx>{{3, 5}, {4, 5}, {5, 8}, {5, 6}, {5, 7}, {6, 8}});
+            }
+            SUBCASE("Branch closed") {
+                // an open branch 3 -> 5 of which the buses are a fill-in of the previous topology
+                comp_topo.branch_node_idx.push_back({3, 5});
+                comp_conn.branch_connected.push_back({0, 0});
+                comp_conn.branch_phase_shift.push_back(0.0);
+                auto const [open_math_topology, open_topo_comp_coup] = Topology{comp_topo, comp_conn}.build_topology();
+                REQUIRE(open_topo_comp_coup->node == comp_coup_ref.node);
+                REQUIRE(open_math_topology[0]->fill_in == fill_in_ref);
+
+                // the closed branch is an entry of the Y bus, so it is no longer a fill-in
+                comp_conn.branch_connected.back() = {1, 1};
+                auto const [cached_math_topology, cached_topo_comp_coup] =
+                    Topology{comp_topo, comp_conn, open_math_topology, *open_topo_comp_coup}.build_topology();
+                CHECK(cached_topo_comp_coup->node == comp_coup_ref.node);
+                CHECK(cached_math_topology[0]->branch_bus_idx.back() == BranchIdx{3, 5});
+                CHECK(cached_math_topology[0]->fill_in == std::vector<BranchIdx>{{4, 5}, {5, 8}, {5, 6}, {5, 7}});
+            }
+            SUBCASE("Node disconnected") {
+                // node 9 is disconnected, the others keep their relative order
+                comp_conn.branch_connected[14] = {1, 0};
+                comp_conn.branch_connected[16] = {1, 0};
+                comp_conn.branch_connected[17] = {1, 0};
+                auto const [cached_math_topology, cached_topo_comp_coup] =
+                    Topology{comp_topo, comp_conn, pair.first, topo_comp_coup}.build_topology();
+                CHECK(cached_topo_comp_coup->node[9].group == -1);
+                for (Idx node = 0; node != 9; ++node) {
+                    CHECK(cached_topo_comp_coup->node[node].pos == node);
+                }
+                CHECK(cached_math_topology[0]->fill_in == fill_in_ref);
+            }
+            SUBCASE("Not a subgraph") {
+                // a new branch 0 -> 9 which is not in the previous graph
+                comp_topo.branch_node_idx.push_back({0, 9});
+                comp_conn.branch_connected.push_back({1, 1});
+                comp_conn.branch_phase_shift.push_back(0.0);
+                auto const [cached_math_topology, cached_topo_comp_coup] =
+                    Topology{comp_topo, comp_conn, pair.first, topo_comp_coup}.build_topology();
+                auto const [fresh_math_topology, fresh_topo_comp_coup] =
+                    Topology{comp_topo, comp_conn}.build_topology();
+                CHECK(cached_topo_comp_coup->node == fresh_topo_comp_coup->node);
+                CHECK(*cached_math_topology[0] == *fresh_math_topology[0]);
+            }
+        }
     }
 
     SUBCASE("7 nodes") {
@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: Contributors to the Power Grid Model project <powergridmodel@lfenergy.org>
+//
+// SPDX-License-Identifier: MPL-2.0
+
+#include <power_grid_model/topology.hpp>
+#include <power_grid_model/topology_snapshot.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace power_grid_model {
+
+namespace {
+/*
+ * math model 0: ring [0] - [1] - [2] - [3] - [0], fill-in (1, 3) when eliminating bus 0
+ *      bus 0 1 2 3 = node 3 0 1 4
+ * math model 1: [0] - [1], with a branch disconnected at the to side
+ *      bus 0 1 = node 5 2
+ * node 6 is isolated
+ */
+TopologySnapshot create_snapshot() {
+    MathModelTopology ring;
+    ring.phase_shift.resize(4);
+    ring.branch_bus_idx = {{0, 1}, {1, 2}, {2, 3}, {3, 0}};
+    ring.fill_in = {{1, 3}};
+
+    MathModelTopology radial;
+    radial.phase_shift.resize(2);
+    radial.branch_bus_idx = {{0, 1}, {1, -1}};
+
+    TopologicalComponentToMathCoupling comp_coup;
+    comp_coup.node = {{.group = 0, .pos = 1}, {.group = 0, .pos = 2}, {.group = 1, .pos = 1}, {.group = 0, .pos = 0},
+                      {.group = 0, .pos = 3}, {.group = 1, .pos = 0}, {.group = -1, .pos = -1}};
+
+    return TopologySnapshot{.math_topology = {std::make_shared<MathModelTopology const>(std::move(ring)),
+                                              std::make_shared<MathModelTopology const>(std::move(radial))},
+                            .comp_coup = std::make_shared<TopologicalComponentToMathCoupling const>(comp_coup)};
+}
+} // namespace
+
+TEST_CASE("Test topology snapshot") {
+    TopologySnapshot const snapshot = create_snapshot();
+    std::vector<char> const data = serialize_topology_snapshot(snapshot);
+
+    SUBCASE("Round trip") {
+        TopologySnapshot const loaded = deserialize_topology_snapshot(data);
+        CHECK(loaded.n_node() == 7);
+        CHECK(loaded.comp_coup->node == snapshot.comp_coup->node);
+        REQUIRE(loaded.math_topology.size() == 2);
+        for (size_t i = 0; i != 2; ++i) {
+            CHECK(loaded.math_topology[i]->n_bus() == snapshot.math_topology[i]->n_bus());
+            CHECK(loaded.math_topology[i]->branch_bus_idx == snapshot.math_topology[i]->branch_bus_idx);
+            CHECK(loaded.math_topology[i]->fill_in == snapshot.math_topology[i]->fill_in);
+        }
+        CHECK(serialize_topology_snapshot(loaded) == data);
+    }
+
+    SUBCASE("Invalid data") {
+        SUBCASE("Wrong magic") {
+            std::vector<char> wrong = data;
+            wrong[0] = 'X';
+            CHECK_THROWS_AS(deserialize_topology_snapshot(wrong), SerializationError);
+        }
+        SUBCASE("Wrong version") {
+            std::vector<char> wrong = data;
+            wrong[8] += 1;
+            CHECK_THROWS_AS(deserialize_topology_snapshot(wrong), SerializationError);
+        }
+        SUBCASE("Truncated") {
+            std::vector<char> const wrong(data.begin(), data.end() - 1);
+            CHECK_THROWS_AS(deserialize_topology_snapshot(wrong), SerializationError);
+        }
+        SUBCASE("Trailing data") {
+            std::vector<char> wrong = data;
+            wrong.push_back(0);
+            CHECK_THROWS_AS(deserialize_topology_snapshot(wrong), SerializationError);
+        }
+    }
+
+    SUBCASE("Invalid ordering") {
+        auto const check_invalid = [&snapshot](MathModelTopology ring) {
+            TopologySnapshot wrong = snapshot;
+            wrong.math_topology[0] = std::make_shared<MathModelTopology const>(std::move(ring));
+            CHECK_THROWS_AS(deserialize_topology_snapshot(serialize_topology_snapshot(wrong)), SerializationError);
+        };
+        MathModelTopology ring = *snapshot.math_topology[0];
+
+        SUBCASE("Missing fill-in") {
+            ring.fill_in.clear();
+            check_invalid(ring);
+        }
+        SUBCASE("Bus out of range") {
+            ring.branch_bus_idx.push_back({0, 4});
+            check_invalid(ring);
+        }
+    }
+
+    SUBCASE("Invalid node coupling") {
+        auto const check_invalid = [&snapshot](std::vector<Idx2D> node) {
+            TopologicalComponentToMathCoupling comp_coup;
+            comp_coup.node = std::move(node);
+            TopologySnapshot wrong = snapshot;
+            wrong.comp_coup = std::make_shared<TopologicalComponentToMathCoupling const>(std::move(comp_coup));
+            CHECK_THROWS_AS(deserialize_topology_snapshot(serialize_topology_snapshot(wrong)), SerializationError);
+        };
+        std::vector<Idx2D> node = snapshot.comp_coup->node;
+
+        SUBCASE("Bus assigned twice") {
+            node[6] = {.group = 0, .pos = 0};
+            check_invalid(node);
+        }
+        SUBCASE("Bus not assigned") {
+            node[5] = {.group = -1, .pos = -1};
+            check_invalid(node);
+        }
+        SUBCASE("Math model out of range") {
+            node[6] = {.group = 2, .pos = 0};
+            check_invalid(node);
+        }
+    }
+}
+
+TEST_CASE("Test topology snapshot with a branch closed") {
+    // ring of four nodes, of which the elimination gives one fill-in
+    ComponentTopology comp_topo{};
+    comp_topo.n_node = 4;
+    comp_topo.branch_node_idx = {{0, 1}, {1, 2}, {2, 3}, {3, 0}};
+    comp_topo.source_node_idx = {0};
+    ComponentConnections comp_conn{};
+    comp_conn.branch_connected = std::vector<BranchConnected>(4, {1, 1});
+    comp_conn.branch_phase_shift = std::vector<double>(4, 0.0);
+    comp_conn.source_connected = {1};
+    auto const [ring_math_topology, ring_comp_coup] = Topology{comp_topo, comp_conn}.build_topology();
+    REQUIRE(ring_math_topology[0]->fill_in.size() == 1);
+
+    // an open branch between the nodes of the fill-in
+    auto const node_of_bus = [&ring_comp_coup](Idx bus) {
+        return static_cast<Idx>(
+            std::distance(ring_comp_coup->node.begin(),
+                          std::ranges::find(ring_comp_coup->node, Idx2D{.group = 0, .pos = bus})));
+    };
+    auto const [fill_in_bus_1, fill_in_bus_2] = ring_math_topology[0]->fill_in[0];
+    comp_topo.branch_node_idx.push_back({node_of_bus(fill_in_bus_1), node_of_bus(fill_in_bus_2)});
+    comp_conn.branch_connected.push_back({0, 0});
+    comp_conn.branch_phase_shift.push_back(0.0);
+
+    // the snapshot is saved with the branch open and loaded with the branch closed
+    auto const [open_math_topology, open_comp_coup] = Topology{comp_topo, comp_conn}.build_topology();
+    std::vector<char> const data = serialize_topology_snapshot(
+        TopologySnapshot{.math_topology = open_math_topology, .comp_coup = open_comp_coup});
+    TopologySnapshot const loaded = deserialize_topology_snapshot(data);
+    comp_conn.branch_connected.back() = {1, 1};
+    auto const [math_topology, comp_coup] =
+        Topology{comp_topo, comp_conn, loaded.math_topology, *loaded.comp_coup}.build_topology();
+
+    // the closed branch is an entry of the Y bus, so it is no longer a fill-in
+    CHECK(comp_coup->node == open_comp_coup->node);
+    CHECK(math_topology[0]->branch_bus_idx.back() == BranchIdx{fill_in_bus_1, fill_in_bus_2});
+    CHECK(math_topology[0]->fill_in.empty());
+}
+
+} // namespace power_grid_model
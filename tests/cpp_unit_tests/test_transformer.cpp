@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MPL-2.0
 
 #include <power_grid_model/component/transformer.hpp>
+#include <power_grid_model/main_core/tap_param_table.hpp>
 
 #include <doctest/doctest.h>
 
@@ -222,6 +223,34 @@ TEST_CASE("Test transformer") {
         }
     }
 
+    SUBCASE("Tap parameter table") {
+        for (auto& transformer : vec) {
+            main_core::TapParamTable<Transformer, symmetric_t> const sym_table{transformer};
+            main_core::TapParamTable<Transformer, asymmetric_t> const asym_table{transformer};
+
+            for (IntS tap_pos = -11; tap_pos <= 9; ++tap_pos) {
+                CAPTURE(tap_pos);
+                transformer.set_tap(tap_pos);
+
+                auto const* sym_param = sym_table.find(transformer);
+                auto const* asym_param = asym_table.find(transformer);
+                REQUIRE(sym_param != nullptr);
+                REQUIRE(asym_param != nullptr);
+                auto const expected_sym = transformer.calc_param<symmetric_t>();
+                auto const expected_asym = transformer.calc_param<asymmetric_t>();
+                for (size_t j = 0; j < 4; j++) {
+                    CHECK(cabs(sym_param->value[j] - expected_sym.value[j]) < numerical_tolerance);
+                    CHECK((cabs(asym_param->value[j] - expected_asym.value[j]) < numerical_tolerance).all());
+                }
+            }
+
+            // the table is only valid for the status it was built with
+            transformer.update(TransformerUpdate{.id = 1, .from_status = 0, .to_status = na_IntS, .tap_pos = na_IntS});
+            CHECK(sym_table.find(transformer) == nullptr);
+            CHECK(asym_table.find(transformer) == nullptr);
+        }
+    }
+
     SUBCASE("Update inverse") {
         TransformerUpdate transformer_update{.id = 1, .from_status = na_IntS, .to_status = na_IntS, .tap_pos = na_IntS};
         auto expected = transformer_update;
@@ -393,9 +393,13 @@ TEST_CASE("Incremental update y-bus") {
     SUBCASE("Test whole scale update") {
         YBus<symmetric_t> ybus{topo_ptr, std::make_shared<MathModelParam<symmetric_t> const>(param_sym)};
         verify_admittance(ybus.admittance(), admittance_sym);
+        YBus<symmetric_t> const ybus_copy{ybus};
+        auto const old_version = ybus.admittance_version();
 
         ybus.update_admittance(std::make_shared<MathModelParam<symmetric_t> const>(param_sym));
         verify_admittance(ybus.admittance(), admittance_sym);
+        CHECK(ybus.admittance_version() != old_version);
+        CHECK(ybus_copy.admittance_version() == old_version);
     }
 
     SUBCASE("Test progressive update") {
@@ -423,9 +427,16 @@ TEST_CASE("Incremental update y-bus") {
                           std::back_inserter(math_model_param_incrmt.shunt_param_to_change));
 
         auto param_update_ptr = std::make_shared<MathModelParam<symmetric_t> const>(param_sym_update);
+        auto const old_version = ybus.admittance_version();
 
         ybus.update_admittance_increment(param_update_ptr, math_model_param_incrmt);
         verify_admittance(ybus.admittance(), admittance_sym_2);
+        CHECK(ybus.admittance_version() != old_version);
+
+        // an increment without affected entries leaves the admittance unchanged
+        auto const unchanged_version = ybus.admittance_version();
+        ybus.update_admittance_increment(param_update_ptr, MathModelParamIncrement{});
+        CHECK(ybus.admittance_version() == unchanged_version);
     }
 }
 
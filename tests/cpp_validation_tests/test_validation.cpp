@@ -294,7 +294,8 @@ std::map<std::string, PGM_TapChangingStrategy, std::less<>> const optimizer_stra
     {"any_valid_tap", PGM_tap_changing_strategy_any_valid_tap},
     {"min_voltage_tap", PGM_tap_changing_strategy_min_voltage_tap},
     {"max_voltage_tap", PGM_tap_changing_strategy_max_voltage_tap},
-    {"fast_any_tap", PGM_tap_changing_strategy_fast_any_tap}};
+    {"fast_any_tap", PGM_tap_changing_strategy_fast_any_tap},
+    {"sensitivity_any_tap", PGM_tap_changing_strategy_sensitivity_any_tap}};
 std::map<std::string, PGM_ExperimentalFeatures, std::less<>> const experimental_features_mapping = {
     {"disabled", PGM_experimental_features_disabled}, {"enabled", PGM_experimental_features_enabled}};
 
@@ -516,13 +517,17 @@ void validate_single_case(CaseParam const& param) {
         auto const validation_case = create_validation_case(param, output_prefix);
         auto const result = create_result_dataset(validation_case.output.value(), output_prefix);
 
-        // create and run model
-        auto const& options = get_options(param);
-        Model model{50.0, validation_case.input.dataset};
-        model.calculate(options, result.dataset);
+        // the math models are set up in parallel with threading, so a new model is created for each run
+        for (Idx const threading : {-1, 2}) {
+            CAPTURE(threading);
+            // create and run model
+            auto const& options = get_options(param, threading);
+            Model model{50.0, validation_case.input.dataset};
+            model.calculate(options, result.dataset);
 
-        // check results
-        assert_result(result, validation_case.output.value(), param.atol, param.rtol);
+            // check results
+            assert_result(result, validation_case.output.value(), param.atol, param.rtol);
+        }
     });
 }
 
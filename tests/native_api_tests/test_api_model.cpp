@@ -12,11 +12,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <exception>
 #include <limits>
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 /*
 Testing network
@@ -298,6 +300,38 @@ TEST_CASE("API Model") {
         }
     }
 
+    SUBCASE("Topology snapshot") {
+        auto const snapshot = model.get_topology_snapshot();
+        CHECK(!snapshot.empty());
+
+        SUBCASE("Load in a new model") {
+            Model model_2{50.0, input_dataset};
+            model_2.load_topology_snapshot(snapshot);
+            model_2.calculate(options, single_output_dataset);
+            node_output.get_value(PGM_def_sym_output_node_u, node_result_u.data(), -1);
+            CHECK(node_result_u[0] == doctest::Approx(50.0));
+            CHECK(model_2.get_topology_snapshot() == snapshot);
+        }
+        SUBCASE("Bad weather: truncated snapshot") {
+            std::vector<char> const truncated(snapshot.begin(), snapshot.end() - 1);
+            CHECK_THROWS_WITH_AS(model.load_topology_snapshot(truncated),
+                                 doctest::Contains("Topology snapshot is truncated"), PowerGridSerializationError);
+        }
+        SUBCASE("Bad weather: wrong number of nodes") {
+            std::vector<ID> const node_id_2{1, 2, 3};
+            std::vector<double> const node_u_rated_2{10.0e3, 10.0e3, 10.0e3};
+
+            DatasetConst input_dataset_2{"input", false, 1};
+            input_dataset_2.add_buffer("node", std::ssize(node_id_2), std::ssize(node_id_2), nullptr, nullptr);
+            input_dataset_2.add_attribute_buffer("node", "id", node_id_2.data());
+            input_dataset_2.add_attribute_buffer("node", "u_rated", node_u_rated_2.data());
+
+            auto model_2 = Model{50.0, input_dataset_2};
+            CHECK_THROWS_WITH_AS(model_2.load_topology_snapshot(snapshot),
+                                 doctest::Contains("different number of nodes"), PowerGridSerializationError);
+        }
+    }
+
     SUBCASE("Batch power flow") {
         model.calculate(options, batch_output_dataset, batch_update_dataset);
         node_batch_output.get_value(PGM_def_sym_output_node_id, batch_node_result_id.data(), -1);
@@ -447,6 +481,60 @@ TEST_CASE("API Model") {
             options.set_tap_changing_strategy(PGM_tap_changing_strategy_min_voltage_tap);
             CHECK_NOTHROW(model.calculate(options, single_output_dataset));
         }
+
+        SUBCASE("Sensitivity tap search") {
+            options.set_tap_changing_strategy(PGM_tap_changing_strategy_sensitivity_any_tap);
+            CHECK_NOTHROW(model.calculate(options, single_output_dataset));
+        }
+
+        SUBCASE("State estimation tracking for power flow error") {
+            auto const bad_tracking_lambda = [&options, &model, &single_output_dataset]() {
+                options.set_state_estimation_tracking(1);
+                model.calculate(options, single_output_dataset);
+            };
+            check_throws_with(bad_tracking_lambda, PGM_regular_error,
+                              "PGM_calculate is not implemented for the following combination of options!"s);
+        }
+
+        SUBCASE("Fault scan for power flow error") {
+            auto const bad_fault_scan_lambda = [&options, &model, &single_output_dataset]() {
+                options.set_short_circuit_fault_scan(1);
+                model.calculate(options, single_output_dataset);
+            };
+            check_throws_with(bad_fault_scan_lambda, PGM_regular_error,
+                              "PGM_calculate is not implemented for the following combination of options!"s);
+        }
+
+        SUBCASE("Speculative tap search without tap changing strategy error") {
+            auto const bad_speculative_lambda = [&options, &model, &single_output_dataset]() {
+                options.set_speculative_tap_search(1);
+                model.calculate(options, single_output_dataset);
+            };
+            check_throws_with(bad_speculative_lambda, PGM_regular_error,
+                              "PGM_calculate is not implemented for the following combination of options!"s);
+        }
+
+        SUBCASE("Speculative tap search") {
+            options.set_tap_changing_strategy(PGM_tap_changing_strategy_min_voltage_tap);
+            options.set_speculative_tap_search(1);
+            options.set_threading(2);
+            CHECK_NOTHROW(model.calculate(options, single_output_dataset));
+        }
+
+        SUBCASE("Tap warm start without tap changing strategy error") {
+            auto const bad_warm_start_lambda = [&options, &model, &single_output_dataset]() {
+                options.set_tap_warm_start(1);
+                model.calculate(options, single_output_dataset);
+            };
+            check_throws_with(bad_warm_start_lambda, PGM_regular_error,
+                              "PGM_calculate is not implemented for the following combination of options!"s);
+        }
+
+        SUBCASE("Tap warm start") {
+            options.set_tap_changing_strategy(PGM_tap_changing_strategy_fast_any_tap);
+            options.set_tap_warm_start(1);
+            CHECK_NOTHROW(model.calculate(options, single_output_dataset));
+        }
     }
 
     SUBCASE("Calculation error") {
@@ -1103,6 +1191,161 @@ TEST_CASE("API Model") {
             CHECK_NOTHROW(run_se_with_current_sensor(method, PGM_experimental_features_enabled));
         }
     }
+
+    SUBCASE("State estimation tracking is experimental") {
+        auto const input_data_se_json = R"json({
+  "version": "1.0",
+  "type": "input",
+  "is_batch": false,
+  "attributes": {},
+  "data": {
+    "node": [
+      {"id": 1, "u_rated": 10000}
+    ],
+    "source": [
+      {"id": 2, "node": 1, "status": 1, "u_ref": 1.0}
+    ],
+    "sym_voltage_sensor": [
+      {"id": 3, "measured_object": 1, "u_sigma": 100, "u_measured": 10000}
+    ]
+  }
+})json";
+
+        auto const owning_input_dataset_se = load_dataset(input_data_se_json);
+        Model tracking_model{50.0, owning_input_dataset_se.dataset};
+        DatasetMutable const output_dataset{"sym_output", false, 1};
+
+        auto const run_se_with_tracking = [&tracking_model, &output_dataset](
+                                              PGM_CalculationMethod method,
+                                              PGM_ExperimentalFeatures experimental_features) {
+            Options tracking_options{};
+            tracking_options.set_calculation_type(PGM_state_estimation);
+            tracking_options.set_calculation_method(method);
+            tracking_options.set_state_estimation_tracking(1);
+            tracking_options.set_experimental_features(experimental_features);
+            tracking_model.calculate(tracking_options, output_dataset);
+        };
+        for (auto const method : {PGM_default_method, PGM_iterative_linear, PGM_newton_raphson}) {
+            CAPTURE(method);
+            CHECK_THROWS_WITH_AS(run_se_with_tracking(method, PGM_experimental_features_disabled),
+                                 "State estimation is not implemented for tracking mode!\n", PowerGridRegularError);
+            CHECK_NOTHROW(run_se_with_tracking(method, PGM_experimental_features_enabled));
+            CHECK_NOTHROW(run_se_with_tracking(method, PGM_experimental_features_enabled));
+        }
+    }
+
+    SUBCASE("Short circuit fault scan") {
+        auto const input_data_sc_json = R"json({
+  "version": "1.0",
+  "type": "input",
+  "is_batch": false,
+  "attributes": {},
+  "data": {
+    "node": [
+      {"id": 1, "u_rated": 10000},
+      {"id": 2, "u_rated": 10000},
+      {"id": 3, "u_rated": 10000}
+    ],
+    "line": [
+      {"id": 4, "from_node": 1, "to_node": 2, "from_status": 1, "to_status": 1, "r1": 0.5, "x1": 1.0, "c1": 0, "tan1": 0, "r0": 1.5, "x0": 3.0, "c0": 0, "tan0": 0, "i_n": 1000},
+      {"id": 5, "from_node": 2, "to_node": 3, "from_status": 1, "to_status": 1, "r1": 1.0, "x1": 0.5, "c1": 0, "tan1": 0, "r0": 3.0, "x0": 1.5, "c0": 0, "tan0": 0, "i_n": 1000}
+    ],
+    "source": [
+      {"id": 6, "node": 1, "status": 1, "u_ref": 1.0, "sk": 1e8, "rx_ratio": 0.1, "z01_ratio": 3.0}
+    ],
+    "fault": [
+      {"id": 7, "status": 1, "fault_type": 0, "fault_phase": 0, "fault_object": 1}
+    ]
+  }
+})json";
+        // the same faults, moved to each node in turn
+        //    three phase faults in the first three scenarios, single phase to ground faults in phase a in the others
+        auto const batch_update_data_sc_json = R"json({
+  "version": "1.0",
+  "type": "update",
+  "is_batch": true,
+  "attributes": {},
+  "data": [
+    {"fault": [{"id": 7, "fault_type": 0, "fault_phase": 0, "fault_object": 1}]},
+    {"fault": [{"id": 7, "fault_type": 0, "fault_phase": 0, "fault_object": 2}]},
+    {"fault": [{"id": 7, "fault_type": 0, "fault_phase": 0, "fault_object": 3}]},
+    {"fault": [{"id": 7, "fault_type": 1, "fault_phase": 1, "fault_object": 1}]},
+    {"fault": [{"id": 7, "fault_type": 1, "fault_phase": 1, "fault_object": 2}]},
+    {"fault": [{"id": 7, "fault_type": 1, "fault_phase": 1, "fault_object": 3}]}
+  ]
+})json";
+        constexpr Idx n_node = 3;
+        constexpr Idx n_scenario = 2 * n_node;
+
+        auto const owning_input_dataset_sc = load_dataset(input_data_sc_json);
+        auto const owning_batch_update_dataset_sc = load_dataset(batch_update_data_sc_json);
+        Model sc_model{50.0, owning_input_dataset_sc.dataset};
+
+        Options sc_options{};
+        sc_options.set_calculation_type(PGM_short_circuit);
+        sc_options.set_symmetric(PGM_asymmetric);
+
+        // fault currents of the faults at each node
+        Buffer fault_batch_output{PGM_def_sc_output_fault, n_scenario};
+        DatasetMutable fault_batch_output_dataset{"sc_output", true, n_scenario};
+        fault_batch_output_dataset.add_buffer("fault", 1, n_scenario, nullptr, fault_batch_output);
+        sc_model.calculate(sc_options, fault_batch_output_dataset, owning_batch_update_dataset_sc.dataset);
+        std::vector<double> fault_i_f(3 * n_scenario);
+        std::vector<double> fault_i_f_angle(3 * n_scenario);
+        fault_batch_output.get_value(PGM_def_sc_output_fault_i_f, fault_i_f.data(), -1);
+        fault_batch_output.get_value(PGM_def_sc_output_fault_i_f_angle, fault_i_f_angle.data(), -1);
+
+        // fault scan in a single calculation
+        Buffer node_sc_output{PGM_def_sc_output_node, n_node};
+        node_sc_output.set_nan();
+        DatasetMutable sc_output_dataset{"sc_output", false, 1};
+        sc_output_dataset.add_buffer("node", n_node, n_node, nullptr, node_sc_output);
+
+        std::vector<double> node_i_f_three_phase(3 * n_node);
+        std::vector<double> node_i_f_three_phase_angle(3 * n_node);
+        std::vector<double> node_i_f_single_phase(3 * n_node);
+        std::vector<double> node_i_f_single_phase_angle(3 * n_node);
+        auto const get_node_fault_currents = [&]() {
+            node_sc_output.get_value(PGM_def_sc_output_node_i_f_three_phase, node_i_f_three_phase.data(), -1);
+            node_sc_output.get_value(PGM_def_sc_output_node_i_f_three_phase_angle, node_i_f_three_phase_angle.data(),
+                                     -1);
+            node_sc_output.get_value(PGM_def_sc_output_node_i_f_single_phase, node_i_f_single_phase.data(), -1);
+            node_sc_output.get_value(PGM_def_sc_output_node_i_f_single_phase_angle,
+                                     node_i_f_single_phase_angle.data(), -1);
+        };
+
+        SUBCASE("Without fault scan") {
+            sc_model.calculate(sc_options, sc_output_dataset);
+            get_node_fault_currents();
+            CHECK(std::ranges::all_of(node_i_f_three_phase, [](double value) { return std::isnan(value); }));
+            CHECK(std::ranges::all_of(node_i_f_single_phase, [](double value) { return std::isnan(value); }));
+        }
+
+        SUBCASE("With fault scan") {
+            sc_options.set_short_circuit_fault_scan(1);
+            sc_model.calculate(sc_options, sc_output_dataset);
+            get_node_fault_currents();
+
+            for (Idx node = 0; node != n_node; ++node) {
+                CAPTURE(node);
+                for (Idx phase = 0; phase != 3; ++phase) {
+                    CAPTURE(phase);
+                    Idx const three_phase_fault = 3 * node + phase;
+                    CHECK(node_i_f_three_phase[3 * node + phase] == doctest::Approx(fault_i_f[three_phase_fault]));
+                    CHECK(node_i_f_three_phase_angle[3 * node + phase] ==
+                          doctest::Approx(fault_i_f_angle[three_phase_fault]));
+                }
+                // single phase to ground fault in phase a
+                Idx const single_phase_fault = 3 * (n_node + node);
+                CHECK(node_i_f_single_phase[3 * node] == doctest::Approx(fault_i_f[single_phase_fault]));
+                CHECK(node_i_f_single_phase_angle[3 * node] ==
+                      doctest::Approx(fault_i_f_angle[single_phase_fault]));
+            }
+            // the fault currents decrease along the feeder
+            CHECK(node_i_f_three_phase[0] > node_i_f_three_phase[3]);
+            CHECK(node_i_f_three_phase[3] > node_i_f_three_phase[6]);
+        }
+    }
 }
 
 } // namespace power_grid_model_cpp
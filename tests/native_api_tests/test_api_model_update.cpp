@@ -829,4 +829,134 @@ TEST_CASE("API model - Incomplete scenario update followed by complete") {
     }
 }
 
+namespace {
+/*
+
+source_5 -- node_1 --line_4-- node_2 --line_6-- node_3 --load_7
+                \___________line_8_____________/        |
+                                                     shunt_9
+
+the batch scenarios only update the shunt and the status of line_8, the math solvers of the batch are reused
+*/
+auto const se_state_json = R"json({
+  "version": "1.0",
+  "type": "input",
+  "is_batch": false,
+  "attributes": {},
+  "data": {
+    "node": [
+      {"id": 1, "u_rated": 10000},
+      {"id": 2, "u_rated": 10000},
+      {"id": 3, "u_rated": 10000}
+    ],
+    "line": [
+      {"id": 4, "from_node": 1, "to_node": 2, "from_status": 1, "to_status": 1, "r1": 0.5, "x1": 1, "c1": 0, "tan1": 0, "r0": 0.5, "x0": 1, "c0": 0, "tan0": 0, "i_n": 1000},
+      {"id": 6, "from_node": 2, "to_node": 3, "from_status": 1, "to_status": 1, "r1": 0.5, "x1": 1, "c1": 0, "tan1": 0, "r0": 0.5, "x0": 1, "c0": 0, "tan0": 0, "i_n": 1000},
+      {"id": 8, "from_node": 1, "to_node": 3, "from_status": 1, "to_status": 1, "r1": 1, "x1": 2, "c1": 0, "tan1": 0, "r0": 1, "x0": 2, "c0": 0, "tan0": 0, "i_n": 1000}
+    ],
+    "source": [
+      {"id": 5, "node": 1, "status": 1, "u_ref": 1.0, "sk": 1000000000000}
+    ],
+    "sym_load": [
+      {"id": 7, "node": 3, "status": 1, "type": 0, "p_specified": 1000000, "q_specified": 200000}
+    ],
+    "shunt": [
+      {"id": 9, "node": 3, "status": 1, "g1": 0, "b1": 0, "g0": 0, "b0": 0}
+    ],
+    "sym_voltage_sensor": [
+      {"id": 10, "measured_object": 1, "u_sigma": 100, "u_measured": 10000, "u_angle_measured": 0}
+    ],
+    "sym_power_sensor": [
+      {"id": 11, "measured_object": 7, "measured_terminal_type": 4, "power_sigma": 10000, "p_measured": 1000000, "q_measured": 200000}
+    ]
+  }
+})json"s;
+
+// each scenario is {status of line_8, b1 of shunt_9}
+std::string se_update_json(std::vector<std::pair<IntS, double>> const& scenarios) {
+    std::string result = R"json({"version": "1.0", "type": "update", "is_batch": true, "attributes": {}, "data": [)json";
+    for (auto const& [line_status, shunt_b1] : scenarios) {
+        if (result.back() == '}') {
+            result += ", ";
+        }
+        result += R"json({"line": [{"id": 8, "from_status": )json" + std::to_string(line_status) +
+                  R"json(, "to_status": )json" + std::to_string(line_status) +
+                  R"json(}], "shunt": [{"id": 9, "b1": )json" + std::to_string(shunt_b1) + "}]}";
+    }
+    return result + "]}";
+}
+
+void check_batch_against_fresh_models(Options& opt, std::vector<std::pair<IntS, double>> const& scenarios) {
+    constexpr Idx n_nodes = 3;
+    auto const owning_input_dataset = load_dataset(se_state_json);
+    auto const& input_dataset = owning_input_dataset.dataset;
+    auto const owning_update_dataset = load_dataset(se_update_json(scenarios));
+    auto const& update_dataset = owning_update_dataset.dataset;
+    auto const batch_size = static_cast<Idx>(scenarios.size());
+    REQUIRE(update_dataset.get_info().batch_size() == batch_size);
+
+    for (Idx const threading : {-1, 0, 2}) {
+        CAPTURE(threading);
+        opt.set_threading(threading);
+
+        std::vector<double> batch_u_pu(batch_size * n_nodes, nan);
+        std::vector<double> batch_u_angle(batch_size * n_nodes, nan);
+        DatasetMutable batch_output{"sym_output", true, batch_size};
+        batch_output.add_buffer("node", n_nodes, batch_size * n_nodes, nullptr, nullptr);
+        batch_output.add_attribute_buffer("node", "u_pu", batch_u_pu.data());
+        batch_output.add_attribute_buffer("node", "u_angle", batch_u_angle.data());
+
+        auto model = Model{50.0, input_dataset};
+        model.calculate(opt, batch_output, update_dataset);
+
+        for (Idx scenario = 0; scenario < batch_size; ++scenario) {
+            CAPTURE(scenario);
+            auto const owning_scenario_dataset = load_dataset(se_update_json({scenarios[scenario]}));
+
+            std::vector<double> ref_u_pu(n_nodes, nan);
+            std::vector<double> ref_u_angle(n_nodes, nan);
+            DatasetMutable ref_output{"sym_output", true, 1};
+            ref_output.add_buffer("node", n_nodes, n_nodes, nullptr, nullptr);
+            ref_output.add_attribute_buffer("node", "u_pu", ref_u_pu.data());
+            ref_output.add_attribute_buffer("node", "u_angle", ref_u_angle.data());
+
+            auto ref_model = Model{50.0, input_dataset};
+            ref_model.calculate(opt, ref_output, owning_scenario_dataset.dataset);
+
+            for (Idx node_idx = 0; node_idx < n_nodes; ++node_idx) {
+                CAPTURE(node_idx);
+                CHECK(batch_u_pu[scenario * n_nodes + node_idx] == doctest::Approx(ref_u_pu[node_idx]));
+                CHECK(batch_u_angle[scenario * n_nodes + node_idx] == doctest::Approx(ref_u_angle[node_idx]));
+            }
+        }
+    }
+}
+} // namespace
+
+TEST_CASE("API model - batch state estimation with only parameter changes") {
+    Options opt;
+    opt.set_calculation_type(PGM_state_estimation);
+    opt.set_symmetric(PGM_symmetric);
+    opt.set_calculation_method(PGM_iterative_linear);
+
+    check_batch_against_fresh_models(opt, {{1, 0.0}, {1, 0.0005}, {1, 0.001}, {1, 0.0}});
+}
+
+TEST_CASE("API model - batch with parameter and topology changes") {
+    auto const scenarios = std::vector<std::pair<IntS, double>>{{1, 0.0}, {0, 0.0005}, {0, 0.001}, {1, 0.001}, {1, 0.0}};
+    Options opt;
+    opt.set_symmetric(PGM_symmetric);
+
+    SUBCASE("State estimation") {
+        opt.set_calculation_type(PGM_state_estimation);
+        opt.set_calculation_method(PGM_iterative_linear);
+        check_batch_against_fresh_models(opt, scenarios);
+    }
+    SUBCASE("Power flow") {
+        opt.set_calculation_type(PGM_power_flow);
+        opt.set_calculation_method(PGM_iterative_current);
+        check_batch_against_fresh_models(opt, scenarios);
+    }
+}
+
 } // namespace power_grid_model_cpp
@@ -9,9 +9,16 @@
 #include <doctest/doctest.h>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <limits>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace power_grid_model_cpp {
@@ -115,6 +122,8 @@ TEST_CASE("API Serialization and Deserialization") {
         Deserializer json_dummy{std::move(json_deserializer)};
         json_deserializer = std::move(json_dummy);
         Deserializer msgpack_deserializer{msgpack_data, 1};
+        // the json is copied, so the data can be released after construction
+        Deserializer released_json_deserializer{std::string{json_data}, 0};
 
         auto check_metadata = [&](DatasetInfo const& info) {
             CHECK(info.name() == "input"s);
@@ -155,6 +164,7 @@ TEST_CASE("API Serialization and Deserialization") {
 
         check_deserializer(json_deserializer);
         check_deserializer(msgpack_deserializer);
+        check_deserializer(released_json_deserializer);
     }
 
     SUBCASE("Deserializer with columnar data") {
@@ -263,4 +273,126 @@ TEST_CASE("API Serialization and Deserialization with float precision") {
     // check
     CHECK(u_rated_ref[0] == u_rated[0]);
 }
+
+// a string with the data is never taken as the path of a file, which is only done by Deserializer::from_file
+static_assert(!std::is_constructible_v<Deserializer, std::string_view, Idx>);
+static_assert(!std::is_constructible_v<Deserializer, std::filesystem::path, Idx>);
+
+TEST_CASE("API Deserialization of a batch from file in chunks") {
+    constexpr char const* batch_json_data =
+        R"({"version":"1.0","type":"update","is_batch":true,"attributes":{"sym_load":["id","p_specified"]},"data":[{"sym_load":[[1,10.0]]},{"sym_load":[[1,20.0],[2,30.0]]},{"sym_load":[[2,40.0]]}]})";
+    auto const file_path = std::filesystem::temp_directory_path() / "pgm_test_api_deserialization_in_chunks.json";
+    {
+        std::ofstream file{file_path, std::ios::binary};
+        file << batch_json_data;
+    }
+
+    {
+        auto deserializer = Deserializer::from_file(file_path, PGM_json);
+        CHECK(deserializer.get_dataset().get_info().batch_size() == 3);
+        deserializer.set_threading(2);
+
+        // parse two scenarios at most at a time into a buffer of bounded size
+        Idx const max_chunk_size = 2;
+        std::vector<double> p_specified;
+        for (Idx first_scenario = 0; first_scenario < 3; first_scenario += max_chunk_size) {
+            Idx const n_scenarios = std::min(max_chunk_size, 3 - first_scenario);
+            deserializer.select_scenarios(first_scenario, n_scenarios);
+            auto& dataset = deserializer.get_dataset();
+            auto const& info = dataset.get_info();
+            CHECK(info.batch_size() == n_scenarios);
+            Idx const n_elements = info.component_total_elements(0);
+            bool const is_uniform = info.component_elements_per_scenario(0) >= 0;
+            std::vector<Idx> indptr(n_scenarios + 1);
+            std::vector<double> p_specified_chunk(n_elements);
+            dataset.set_buffer("sym_load", is_uniform ? nullptr : indptr.data(), nullptr);
+            dataset.set_attribute_buffer("sym_load", "p_specified", p_specified_chunk.data());
+            deserializer.parse_to_buffer();
+            p_specified.insert(p_specified.end(), p_specified_chunk.begin(), p_specified_chunk.end());
+        }
+        CHECK(p_specified == std::vector<double>{10.0, 20.0, 30.0, 40.0});
+
+        CHECK_THROWS_AS(deserializer.select_scenarios(2, 2), PowerGridSerializationError);
+    }
+    std::filesystem::remove(file_path);
+
+    CHECK_THROWS_AS(Deserializer::from_file(file_path, PGM_json), PowerGridSerializationError);
+}
+
+TEST_CASE("API Serialization to a sink and a file") {
+    std::vector<ID> const node_id{1, 2, 3};
+    std::vector<double> const u_rated{10.5e3, 0.4e3, 150.0e3};
+    DatasetConst dataset{"input", false, 1};
+    dataset.add_buffer("node", 3, 3, nullptr, nullptr);
+    dataset.add_attribute_buffer("node", "id", node_id.data());
+    dataset.add_attribute_buffer("node", "u_rated", u_rated.data());
+
+    SUBCASE("json") {
+        Serializer serializer{dataset, PGM_json};
+        std::string written;
+        auto sink = [&written](std::string_view data) { written += data; };
+        serializer.write(sink, 1, 2);
+        CHECK(written == serializer.get_to_zero_terminated_string(1, 2));
+
+        auto const file_path = std::filesystem::temp_directory_path() / "pgm_test_api_serialization_to_file.json";
+        serializer.write_to_file(file_path, 0, -1);
+        std::string file_content;
+        {
+            std::ifstream file{file_path, std::ios::binary};
+            file_content.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+        }
+        std::filesystem::remove(file_path);
+        CHECK(file_content == serializer.get_to_zero_terminated_string(0, -1));
+    }
+
+    SUBCASE("msgpack") {
+        Serializer serializer{dataset, PGM_msgpack};
+        std::string written;
+        auto sink = [&written](std::string_view data) { written += data; };
+        serializer.write(sink, 0, -1);
+        CHECK(written == serializer.get_to_binary_buffer(0));
+    }
+
+    SUBCASE("Exception in sink") {
+        Serializer serializer{dataset, PGM_json};
+        auto throwing_sink = [](std::string_view /* data */) { throw std::runtime_error{"sink full"}; };
+        CHECK_THROWS_AS(serializer.write(throwing_sink, 1, -1), std::runtime_error);
+    }
+}
+
+TEST_CASE("API Serialization in the columnar format") {
+    constexpr char const* batch_json_data =
+        R"({"version":"1.0","type":"update","is_batch":true,"attributes":{},"data":[{"sym_load":[{"id":1,"p_specified":10}]},{"sym_load":[{"id":1,"p_specified":20},{"id":2,"status":0}]}]})";
+    auto const file_path = std::filesystem::temp_directory_path() / "pgm_test_api_serialization_columnar.pgmc";
+
+    // convert json to the columnar format
+    {
+        Deserializer json_deserializer{batch_json_data, PGM_json};
+        auto& writable_dataset = json_deserializer.get_dataset();
+        std::vector<Idx> indptr(3);
+        std::vector<ID> id(3);
+        std::vector<int8_t> status(3);
+        std::vector<double> p_specified(3);
+        writable_dataset.set_buffer("sym_load", indptr.data(), nullptr);
+        writable_dataset.set_attribute_buffer("sym_load", "id", id.data());
+        writable_dataset.set_attribute_buffer("sym_load", "status", status.data());
+        writable_dataset.set_attribute_buffer("sym_load", "p_specified", p_specified.data());
+        json_deserializer.parse_to_buffer();
+        Serializer serializer{DatasetConst{writable_dataset}, PGM_columnar};
+        serializer.write_to_file(file_path, 0, -1);
+        CHECK_THROWS_AS(serializer.get_to_zero_terminated_string(0, -1), PowerGridSerializationError);
+    }
+
+    {
+        auto deserializer = Deserializer::from_file(file_path, PGM_columnar);
+        DatasetConst const dataset = deserializer.create_columnar_dataset();
+        CHECK(dataset.get_info().batch_size() == 2);
+        CHECK(dataset.get_info().component_total_elements(0) == 3);
+
+        // the data is used in place, serializing it again gives the original json
+        Serializer json_serializer{dataset, PGM_json};
+        CHECK(json_serializer.get_to_zero_terminated_string(0, -1) == batch_json_data);
+    }
+    std::filesystem::remove(file_path);
+}
 } // namespace power_grid_model_cpp